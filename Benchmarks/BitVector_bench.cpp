@@ -0,0 +1,182 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+#include "Benchmarks/Measure.hpp"
+#include "Benchmarks/PerfCounters.hpp"
+#include "Source/BitVector.hpp"
+#include "Source/Vector.hpp"
+
+// Each iteration intersects two membership masks and counts the survivors, as the filter loops do.
+static constexpr size_t MaskSize = 1 << 20;
+
+static bool isMember(size_t i, size_t salt) { return ((i * 2654435761u) >> 7 ^ salt) % 3 == 0; }
+
+static void BM_MyBitVectorAndCount(benchmark::State& state) {
+  MySTL::BitVector a(MaskSize);
+  MySTL::BitVector b(MaskSize);
+  for (size_t i{}; i < MaskSize; ++i) {
+    a.set(i, isMember(i, 1));
+    b.set(i, isMember(i, 2));
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::BitVector result(a);
+      result &= b;
+      benchmark::DoNotOptimize(result.count());
+    }
+  });
+  state.counters["bytes"] = static_cast<double>(a.num_words() * sizeof(uint64_t));
+  state.counters["flags/sec"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * MaskSize),
+                         benchmark::Counter::kIsRate);
+}
+
+static void BM_STDVectorBoolAndCount(benchmark::State& state) {
+  std::vector<bool> a(MaskSize);
+  std::vector<bool> b(MaskSize);
+  for (size_t i{}; i < MaskSize; ++i) {
+    a[i] = isMember(i, 1);
+    b[i] = isMember(i, 2);
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      std::vector<bool> result(a);
+      for (size_t i{}; i < MaskSize; ++i) {
+        result[i] = result[i] && b[i];
+      }
+      benchmark::DoNotOptimize(std::count(result.begin(), result.end(), true));
+    }
+  });
+  state.counters["bytes"] = static_cast<double>(MaskSize / 8);
+  state.counters["flags/sec"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * MaskSize),
+                         benchmark::Counter::kIsRate);
+}
+
+// dynamic_bitset-style baseline: plain words with a scalar loop
+static void BM_STDVectorWordsAndCount(benchmark::State& state) {
+  std::vector<uint64_t> a(MaskSize / 64);
+  std::vector<uint64_t> b(MaskSize / 64);
+  for (size_t i{}; i < MaskSize; ++i) {
+    a[i / 64] |= uint64_t{isMember(i, 1)} << (i % 64);
+    b[i / 64] |= uint64_t{isMember(i, 2)} << (i % 64);
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      std::vector<uint64_t> result(a);
+      size_t count{};
+      for (size_t i{}; i < result.size(); ++i) {
+        result[i] &= b[i];
+        count += std::popcount(result[i]);
+      }
+      benchmark::DoNotOptimize(count);
+    }
+  });
+  state.counters["bytes"] = static_cast<double>(a.size() * sizeof(uint64_t));
+  state.counters["flags/sec"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * MaskSize),
+                         benchmark::Counter::kIsRate);
+}
+
+// Current approach: one byte per flag
+static void BM_MyVectorBoolAndCount(benchmark::State& state) {
+  MySTL::Vector<bool> a;
+  MySTL::Vector<bool> b;
+  a.reserve(MaskSize);
+  b.reserve(MaskSize);
+  for (size_t i{}; i < MaskSize; ++i) {
+    a.push_back(isMember(i, 1));
+    b.push_back(isMember(i, 2));
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::Vector<bool> result(a);
+      size_t count{};
+      for (size_t i{}; i < MaskSize; ++i) {
+        result[i] = result[i] && b[i];
+        count += result[i];
+      }
+      benchmark::DoNotOptimize(count);
+    }
+  });
+  state.counters["bytes"] = static_cast<double>(MaskSize);
+  state.counters["flags/sec"] =
+      benchmark::Counter(static_cast<double>(state.iterations() * MaskSize),
+                         benchmark::Counter::kIsRate);
+}
+
+static void BM_MyBitVectorFindNext(benchmark::State& state) {
+  MySTL::BitVector bits(MaskSize);
+  for (size_t i{}; i < MaskSize; i += 97) {
+    bits.set(i);
+  }
+
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    size_t visited{};
+    for (size_t i = bits.find_first(); i != MySTL::BitVector::npos; i = bits.find_next(i)) {
+      ++visited;
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  perf.stop();
+
+  perf.report(state);
+}
+
+static void BM_STDVectorBoolFindNext(benchmark::State& state) {
+  std::vector<bool> bits(MaskSize);
+  for (size_t i{}; i < MaskSize; i += 97) {
+    bits[i] = true;
+  }
+
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    size_t visited{};
+    for (auto it = std::find(bits.begin(), bits.end(), true); it != bits.end();
+         it = std::find(it + 1, bits.end(), true)) {
+      ++visited;
+    }
+    benchmark::DoNotOptimize(visited);
+  }
+  perf.stop();
+
+  perf.report(state);
+}
+
+static void BM_MyBitVectorRank(benchmark::State& state) {
+  MySTL::BitVector bits(MaskSize);
+  for (size_t i{}; i < MaskSize; ++i) {
+    bits.set(i, isMember(i, 1));
+  }
+
+  if (state.range(0)) {
+    bits.buildRankIndex();
+  }
+
+  size_t pos{};
+  for (auto _ : state) {
+    pos = (pos + 7919) % MaskSize;
+    benchmark::DoNotOptimize(bits.rank(pos));
+  }
+}
+
+BENCHMARK(BM_MyBitVectorAndCount);
+BENCHMARK(BM_STDVectorBoolAndCount);
+BENCHMARK(BM_STDVectorWordsAndCount);
+BENCHMARK(BM_MyVectorBoolAndCount);
+BENCHMARK(BM_MyBitVectorFindNext);
+BENCHMARK(BM_STDVectorBoolFindNext);
+BENCHMARK(BM_MyBitVectorRank)->Arg(0)->Arg(1);
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "Source/TrackingAllocator.hpp"
+
+// Replaces the global operator new/delete so every heap allocation made by the benchmark binary is
+// recorded in MySTL::Bench::heapStats(). The replacements are not inline, so this header must be
+// included from exactly one translation unit per benchmark executable.
+
+namespace MySTL::Bench {
+
+[[nodiscard]] inline AllocationStats& heapStats() noexcept {
+  static AllocationStats stats;
+  return stats;
+}
+
+namespace Detail {
+
+// Unsized delete does not know the block size, so it is stored in a header in front of the block.
+inline constexpr size_t HeapHeaderSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// Kept out of line so GCC does not see the malloc/free pair through inlined new/delete and flag it
+// with -Wmismatched-new-delete.
+[[gnu::noinline]] inline void* countedAllocate(size_t size) noexcept {
+  void* block = std::malloc(size + HeapHeaderSize);
+  if (!block) {
+    return nullptr;
+  }
+
+  *static_cast<size_t*>(block) = size;
+  heapStats().recordAllocation(size);
+  return static_cast<std::byte*>(block) + HeapHeaderSize;
+}
+
+[[gnu::noinline]] inline void countedDeallocate(void* ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+
+  void* block = static_cast<std::byte*>(ptr) - HeapHeaderSize;
+  heapStats().recordDeallocation(*static_cast<size_t*>(block));
+  std::free(block);
+}
+
+// Over-aligned blocks get a header as large as their alignment so the returned pointer stays
+// aligned; the aligned delete overloads receive the alignment and find the header again.
+[[nodiscard]] inline size_t alignedHeaderSize(std::align_val_t alignment) noexcept {
+  return std::max(static_cast<size_t>(alignment), HeapHeaderSize);
+}
+
+[[gnu::noinline]] inline void* countedAllocateAligned(size_t size,
+                                                      std::align_val_t alignment) noexcept {
+  size_t header = alignedHeaderSize(alignment);
+  // aligned_alloc wants a size that is a multiple of the alignment
+  size_t total = (size + header + header - 1) / header * header;
+  void* block = std::aligned_alloc(header, total);
+  if (!block) {
+    return nullptr;
+  }
+
+  *static_cast<size_t*>(block) = size;
+  heapStats().recordAllocation(size);
+  return static_cast<std::byte*>(block) + header;
+}
+
+[[gnu::noinline]] inline void countedDeallocateAligned(void* ptr,
+                                                       std::align_val_t alignment) noexcept {
+  if (!ptr) {
+    return;
+  }
+
+  void* block = static_cast<std::byte*>(ptr) - alignedHeaderSize(alignment);
+  heapStats().recordDeallocation(*static_cast<size_t*>(block));
+  std::free(block);
+}
+
+}  // namespace Detail
+
+// Heap traffic between start() and stop(), reported per iteration next to the timings.
+//
+//   MySTL::Bench::HeapProfile heap;
+//   heap.start();
+//   for (auto _ : state) { ... }
+//   heap.stop();
+//   heap.report(state);
+class HeapProfile {
+ public:
+  void start() noexcept {
+    AllocationStats& stats = heapStats();
+    m_baseLive = stats.liveBytes.load(std::memory_order_relaxed);
+    m_baseAllocations = stats.allocations.load(std::memory_order_relaxed);
+    m_baseBytes = stats.bytesAllocated.load(std::memory_order_relaxed);
+    stats.peakBytes.store(m_baseLive, std::memory_order_relaxed);
+  }
+
+  void stop() noexcept {
+    AllocationStats& stats = heapStats();
+    m_allocations = stats.allocations.load(std::memory_order_relaxed) - m_baseAllocations;
+    m_bytes = stats.bytesAllocated.load(std::memory_order_relaxed) - m_baseBytes;
+    m_peak = stats.peakBytes.load(std::memory_order_relaxed) - m_baseLive;
+  }
+
+  void report(benchmark::State& state) const {
+    state.counters["allocs/op"] =
+        benchmark::Counter(static_cast<double>(m_allocations), benchmark::Counter::kAvgIterations);
+    state.counters["bytes/op"] =
+        benchmark::Counter(static_cast<double>(m_bytes), benchmark::Counter::kAvgIterations);
+    state.counters["peak-bytes"] = static_cast<double>(m_peak);
+  }
+
+  // size()/capacity() of a container once the loop is done.
+  template <typename Container>
+  static void reportUtilization(benchmark::State& state, const Container& container) {
+    state.counters["utilization"] =
+        container.capacity() == 0
+            ? 1.0
+            : static_cast<double>(container.size()) / static_cast<double>(container.capacity());
+  }
+
+ private:
+  size_t m_baseLive{};
+  size_t m_baseAllocations{};
+  size_t m_baseBytes{};
+  size_t m_allocations{};
+  size_t m_bytes{};
+  size_t m_peak{};
+};
+
+}  // namespace MySTL::Bench
+
+void* operator new(size_t size) {
+  void* ptr = MySTL::Bench::Detail::countedAllocate(size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size) { return ::operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return MySTL::Bench::Detail::countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return MySTL::Bench::Detail::countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept { MySTL::Bench::Detail::countedDeallocate(ptr); }
+void operator delete[](void* ptr) noexcept { MySTL::Bench::Detail::countedDeallocate(ptr); }
+void operator delete(void* ptr, size_t) noexcept { MySTL::Bench::Detail::countedDeallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { MySTL::Bench::Detail::countedDeallocate(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  MySTL::Bench::Detail::countedDeallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  MySTL::Bench::Detail::countedDeallocate(ptr);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  void* ptr = MySTL::Bench::Detail::countedAllocateAligned(size, alignment);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return ::operator new(size, alignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return MySTL::Bench::Detail::countedAllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return MySTL::Bench::Detail::countedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  MySTL::Bench::Detail::countedDeallocateAligned(ptr, alignment);
+}
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+#include "Benchmarks/Measure.hpp"
+#include "Source/InplaceVector.hpp"
+#include "Source/Vector.hpp"
+
+// Each iteration fills a batch of up to BatchSize packets and drains it, as the latency path does.
+static constexpr size_t BatchSize = 64;
+
+static void BM_MyInplaceVectorBatch(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::InplaceVector<uint64_t, BatchSize> batch;
+
+      for (size_t i{}; i < BatchSize; ++i) {
+        batch.unchecked_push_back(count++);
+      }
+
+      uint64_t sum{};
+      for (uint64_t item : batch) {
+        sum += item;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+  });
+  state.counters["items/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_MyVectorReservedBatch(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::Vector<uint64_t> batch;
+      batch.reserve(BatchSize);
+
+      for (size_t i{}; i < BatchSize; ++i) {
+        batch.push_back(count++);
+      }
+
+      uint64_t sum{};
+      for (uint64_t item : batch) {
+        sum += item;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+  });
+  state.counters["items/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_STDArrayBatch(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      std::array<uint64_t, BatchSize> batch;
+      size_t size{};
+
+      for (size_t i{}; i < BatchSize; ++i) {
+        batch[size++] = count++;
+      }
+
+      uint64_t sum{};
+      for (size_t i{}; i < size; ++i) {
+        sum += batch[i];
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+  });
+  state.counters["items/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_MyInplaceVectorBatch)->Repetitions(5);
+BENCHMARK(BM_MyVectorReservedBatch)->Repetitions(5);
+BENCHMARK(BM_STDArrayBatch)->Repetitions(5);
+BENCHMARK_MAIN();
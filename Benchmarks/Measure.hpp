@@ -0,0 +1,34 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+#include "Benchmarks/HeapProfile.hpp"
+#include "Benchmarks/PerfCounters.hpp"
+
+namespace MySTL::Bench {
+
+// Runs the benchmark loop between hardware counters and a heap profile and reports both. The perf
+// counters start last and stop first so the heap bookkeeping stays out of them. Pulls in
+// HeapProfile.hpp, so the same one translation unit per executable rule applies.
+//
+//   MySTL::Bench::measure(state, [&] {
+//     for (auto _ : state) { ... }
+//   });
+template <typename Loop>
+void measure(benchmark::State& state, Loop&& loop) {
+  PerfCounters perf;
+  HeapProfile heap;
+
+  heap.start();
+  perf.start();
+  std::forward<Loop>(loop)();
+  perf.stop();
+  heap.stop();
+
+  perf.report(state);
+  heap.report(state);
+}
+
+}  // namespace MySTL::Bench
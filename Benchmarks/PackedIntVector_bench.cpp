@@ -0,0 +1,205 @@
+#include <benchmark/benchmark.h>
+
+#include "Benchmarks/HeapProfile.hpp"
+#include "Benchmarks/PerfCounters.hpp"
+#include "Source/DeltaVector.hpp"
+#include "Source/PackedIntVector.hpp"
+#include "Source/Vector.hpp"
+
+static constexpr size_t ValueCount = 1 << 22;
+static constexpr unsigned IdBits = 20;
+static constexpr size_t LookupCount = 4096;
+
+// Small IDs below 2^20 for the packed vectors
+static uint64_t idAt(size_t index) { return (index * 0x9E3779B97F4A7C15ull) >> (64 - IdBits); }
+
+// Millisecond timestamps with gaps below 64 for the delta vector
+static uint64_t timestampAt(size_t index) {
+  return 1700000000000ull + index * 32 + ((index * 0x9E3779B97F4A7C15ull) >> 59);
+}
+
+template <typename Container, typename Generator>
+static Container build(Container container, Generator generate) {
+  for (size_t i{}; i < ValueCount; ++i) {
+    container.push_back(generate(i));
+  }
+  return container;
+}
+
+static const MySTL::Vector<uint64_t>& vectorIds() {
+  static const auto vector = build(MySTL::Vector<uint64_t>(), idAt);
+  return vector;
+}
+
+static const MySTL::PackedIntVector<IdBits>& packedIds() {
+  static const auto vector = build(MySTL::PackedIntVector<IdBits>(), idAt);
+  return vector;
+}
+
+static const MySTL::PackedIntVector<>& dynamicPackedIds() {
+  static const auto vector = build(MySTL::PackedIntVector<>(IdBits), idAt);
+  return vector;
+}
+
+static const MySTL::Vector<uint64_t>& vectorTimestamps() {
+  static const auto vector = build(MySTL::Vector<uint64_t>(), timestampAt);
+  return vector;
+}
+
+static const MySTL::DeltaVector& deltaTimestamps() {
+  static const auto vector = build(MySTL::DeltaVector(), timestampAt);
+  return vector;
+}
+
+static MySTL::Vector<size_t> lookupIndices() {
+  MySTL::Vector<size_t> indices;
+  uint64_t state = 88172645463325252ull;
+
+  for (size_t i{}; i < LookupCount; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    indices.push_back(state % ValueCount);
+  }
+
+  return indices;
+}
+
+static size_t storageBytes(const MySTL::Vector<uint64_t>& vector) {
+  return vector.size() * sizeof(uint64_t);
+}
+template <unsigned Width>
+static size_t storageBytes(const MySTL::PackedIntVector<Width>& vector) {
+  return vector.num_words() * sizeof(uint64_t);
+}
+static size_t storageBytes(const MySTL::DeltaVector& vector) { return vector.storageBytes(); }
+
+// bits/element counts the encoded data; peak-bytes also includes the growth slack of the Vectors
+template <typename Container, typename Generator>
+static void buildBenchmark(benchmark::State& state, Container empty, Generator generate) {
+  MySTL::Bench::HeapProfile heap;
+  size_t bytes{};
+
+  heap.start();
+  for (auto _ : state) {
+    Container container = build(empty, generate);
+    bytes = storageBytes(container);
+    benchmark::DoNotOptimize(&container);
+  }
+  heap.stop();
+
+  heap.report(state);
+  state.counters["bits/element"] = static_cast<double>(bytes) * 8 / ValueCount;
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ValueCount));
+}
+
+// Decoded output in GB/s; the packed vectors decode a block at a time into a buffer
+template <typename Container>
+static void decodeBenchmark(benchmark::State& state, const Container& container) {
+  MySTL::Bench::PerfCounters perf;
+  uint64_t buffer[128];
+
+  perf.start();
+  for (auto _ : state) {
+    uint64_t sum{};
+    for (size_t first{}; first < ValueCount; first += 128) {
+      container.decode(first, 128, buffer);
+      for (uint64_t value : buffer) {
+        sum += value;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * ValueCount * sizeof(uint64_t)));
+}
+
+template <typename Container>
+static void randomAccessBenchmark(benchmark::State& state, const Container& container) {
+  MySTL::Vector<size_t> indices = lookupIndices();
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    uint64_t sum{};
+    for (size_t index : indices) {
+      sum += container[index];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * LookupCount));
+}
+
+static void BM_MyVectorBuild(benchmark::State& state) {
+  buildBenchmark(state, MySTL::Vector<uint64_t>(), idAt);
+}
+static void BM_MyPackedIntVectorBuild(benchmark::State& state) {
+  buildBenchmark(state, MySTL::PackedIntVector<IdBits>(), idAt);
+}
+static void BM_MyDeltaVectorBuild(benchmark::State& state) {
+  buildBenchmark(state, MySTL::DeltaVector(), timestampAt);
+}
+
+static void BM_MyVectorScan(benchmark::State& state) {
+  const MySTL::Vector<uint64_t>& vector = vectorIds();
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    uint64_t sum{};
+    for (uint64_t value : vector) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * ValueCount * sizeof(uint64_t)));
+}
+static void BM_MyPackedIntVectorDecode(benchmark::State& state) {
+  decodeBenchmark(state, packedIds());
+}
+static void BM_MyPackedIntVectorDynamicDecode(benchmark::State& state) {
+  decodeBenchmark(state, dynamicPackedIds());
+}
+static void BM_MyDeltaVectorDecode(benchmark::State& state) {
+  decodeBenchmark(state, deltaTimestamps());
+}
+
+static void BM_MyVectorRandomAccess(benchmark::State& state) {
+  randomAccessBenchmark(state, vectorIds());
+}
+static void BM_MyPackedIntVectorRandomAccess(benchmark::State& state) {
+  randomAccessBenchmark(state, packedIds());
+}
+static void BM_MyPackedIntVectorDynamicRandomAccess(benchmark::State& state) {
+  randomAccessBenchmark(state, dynamicPackedIds());
+}
+static void BM_MyVectorTimestampRandomAccess(benchmark::State& state) {
+  randomAccessBenchmark(state, vectorTimestamps());
+}
+static void BM_MyDeltaVectorRandomAccess(benchmark::State& state) {
+  randomAccessBenchmark(state, deltaTimestamps());
+}
+
+BENCHMARK(BM_MyVectorBuild);
+BENCHMARK(BM_MyPackedIntVectorBuild);
+BENCHMARK(BM_MyDeltaVectorBuild);
+BENCHMARK(BM_MyVectorScan);
+BENCHMARK(BM_MyPackedIntVectorDecode);
+BENCHMARK(BM_MyPackedIntVectorDynamicDecode);
+BENCHMARK(BM_MyDeltaVectorDecode);
+BENCHMARK(BM_MyVectorRandomAccess);
+BENCHMARK(BM_MyPackedIntVectorRandomAccess);
+BENCHMARK(BM_MyPackedIntVectorDynamicRandomAccess);
+BENCHMARK(BM_MyVectorTimestampRandomAccess);
+BENCHMARK(BM_MyDeltaVectorRandomAccess);
+BENCHMARK_MAIN();
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MySTL::Bench {
+
+// Hardware counters read through perf_event_open(2). Every event is opened on its own (no group
+// leader) so a single unsupported event does not take the rest down with it. When nothing can be
+// opened (non-Linux, containers without CAP_PERFMON, perf_event_paranoid too high) the benchmark
+// still runs and only reports that counters were unavailable.
+//
+//   MySTL::Bench::PerfCounters perf;
+//   perf.start();
+//   for (auto _ : state) { ... }
+//   perf.stop();
+//   perf.report(state);
+class PerfCounters {
+ public:
+  enum Event : size_t {
+    Cycles,
+    Instructions,
+    L1DMisses,
+    LLCMisses,
+    BranchMisses,
+    DTLBMisses,
+    EventCount
+  };
+
+  PerfCounters() noexcept {
+    for (size_t i{}; i < EventCount; ++i) {
+      m_fds[i] = open(static_cast<Event>(i));
+    }
+  }
+
+  ~PerfCounters() noexcept {
+#if defined(__linux__)
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+  PerfCounters(PerfCounters&&) = delete;
+  PerfCounters& operator=(PerfCounters&&) = delete;
+
+  [[nodiscard]] bool available() const noexcept {
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  void start() noexcept {
+#if defined(__linux__)
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  void stop() noexcept {
+#if defined(__linux__)
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+#endif
+  }
+
+  // Value of an event since the last start(), scaled up when the kernel had to multiplex it.
+  // Returns a negative value when the event could not be opened or read.
+  [[nodiscard]] double read(Event event) const noexcept {
+#if defined(__linux__)
+    int fd = m_fds[event];
+    if (fd < 0) {
+      return -1.0;
+    }
+
+    // Layout for PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+    struct {
+      uint64_t value;
+      uint64_t timeEnabled;
+      uint64_t timeRunning;
+    } data{};
+
+    if (::read(fd, &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+      return -1.0;
+    }
+
+    if (data.timeRunning == 0) {
+      return data.timeEnabled == 0 ? 0.0 : -1.0;
+    }
+
+    return static_cast<double>(data.value) * static_cast<double>(data.timeEnabled) /
+           static_cast<double>(data.timeRunning);
+#else
+    (void)event;
+    return -1.0;
+#endif
+  }
+
+  // Publishes every available event as a per-iteration counter, plus IPC when both cycles and
+  // instructions were measured. Every thread reports its own IPC, so threaded runs average them.
+  void report(benchmark::State& state) const {
+    if (!available()) {
+      state.SetLabel("perf counters unavailable");
+      return;
+    }
+
+    static constexpr std::array<const char*, EventCount> names{
+        "cycles", "instructions", "L1d-misses", "LLC-misses", "branch-misses", "dTLB-misses"};
+
+    for (size_t i{}; i < EventCount; ++i) {
+      double value = read(static_cast<Event>(i));
+      if (value >= 0.0) {
+        state.counters[names[i]] = benchmark::Counter(value, benchmark::Counter::kAvgIterations);
+      }
+    }
+
+    double cycles = read(Cycles);
+    double instructions = read(Instructions);
+    if (cycles > 0.0 && instructions >= 0.0) {
+      state.counters["IPC"] =
+          benchmark::Counter(instructions / cycles, benchmark::Counter::kAvgThreads);
+    }
+  }
+
+ private:
+  static int open(Event event) noexcept {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    auto cacheMiss = [](uint64_t cache) {
+      return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+
+    switch (event) {
+      case Cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case Instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case L1DMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cacheMiss(PERF_COUNT_HW_CACHE_L1D);
+        break;
+      case LLCMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cacheMiss(PERF_COUNT_HW_CACHE_LL);
+        break;
+      case BranchMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case DTLBMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cacheMiss(PERF_COUNT_HW_CACHE_DTLB);
+        break;
+      default:
+        return -1;
+    }
+
+    long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return fd < 0 ? -1 : static_cast<int>(fd);
+#else
+    (void)event;
+    return -1;
+#endif
+  }
+
+  std::array<int, EventCount> m_fds{};
+};
+
+}  // namespace MySTL::Bench
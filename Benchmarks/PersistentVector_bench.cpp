@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+
+#include "Benchmarks/Measure.hpp"
+#include "Source/PersistentVector.hpp"
+#include "Source/Vector.hpp"
+
+// Routing table sized like the ones read by the services
+static constexpr size_t TableSize = 100000;
+
+static MySTL::PersistentVector<uint64_t> makePersistentTable() {
+  auto transient = MySTL::PersistentVector<uint64_t>().transient();
+
+  for (size_t i{}; i < TableSize; ++i) {
+    transient.push_back(i);
+  }
+
+  return transient.persistent();
+}
+
+static void BM_MyPersistentVectorUpdate(benchmark::State& state) {
+  uint64_t count = 0;
+
+  auto table = makePersistentTable();
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      table = table.set((count * 7919) % TableSize, count);
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_MyPersistentVectorBatchUpdate(benchmark::State& state) {
+  uint64_t count = 0;
+
+  auto table = makePersistentTable();
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      auto transient = table.transient();
+      for (size_t i{}; i < 64; ++i) {
+        transient.set((count * 7919) % TableSize, count);
+        ++count;
+      }
+      table = transient.persistent();
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+// What the services do today: copy the whole table, change it and swap it in
+static void BM_MyVectorCopyAndSwapUpdate(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Vector<uint64_t> table;
+  table.reserve(TableSize);
+  for (size_t i{}; i < TableSize; ++i) {
+    table.push_back(i);
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::Vector<uint64_t> copy(table);
+      copy[(count * 7919) % TableSize] = count;
+      table = std::move(copy);
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+// Thread 0 keeps publishing new versions while the others read through a snapshot
+static MySTL::AtomicPersistentVector<uint64_t> persistentTable(makePersistentTable());
+
+static void BM_MyPersistentVectorReaders(benchmark::State& state) {
+  uint64_t count = 0;
+  uint64_t sum = 0;
+
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      persistentTable.update([count](const MySTL::PersistentVector<uint64_t>& current) {
+        return current.set(count % TableSize, count);
+      });
+    } else {
+      auto snapshot = persistentTable.load();
+      for (size_t i{}; i < 64; ++i) {
+        sum += (*snapshot)[(count * 64 + i) * 7919 % TableSize];
+      }
+    }
+
+    ++count;
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.counters["reads/sec"] = benchmark::Counter(
+      state.thread_index() == 0 ? 0.0 : static_cast<double>(count * 64),
+      benchmark::Counter::kIsRate);
+}
+
+static std::shared_ptr<const MySTL::Vector<uint64_t>> vectorTable = [] {
+  auto table = std::make_shared<MySTL::Vector<uint64_t>>();
+  table->reserve(TableSize);
+  for (size_t i{}; i < TableSize; ++i) {
+    table->push_back(i);
+  }
+  return table;
+}();
+
+static void BM_MyVectorCopyAndSwapReaders(benchmark::State& state) {
+  uint64_t count = 0;
+  uint64_t sum = 0;
+
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      auto current = std::atomic_load(&vectorTable);
+      auto copy = std::make_shared<MySTL::Vector<uint64_t>>(*current);
+      (*copy)[count % TableSize] = count;
+      std::atomic_store(&vectorTable, std::shared_ptr<const MySTL::Vector<uint64_t>>(copy));
+    } else {
+      auto snapshot = std::atomic_load(&vectorTable);
+      for (size_t i{}; i < 64; ++i) {
+        sum += (*snapshot)[(count * 64 + i) * 7919 % TableSize];
+      }
+    }
+
+    ++count;
+  }
+
+  benchmark::DoNotOptimize(sum);
+  state.counters["reads/sec"] = benchmark::Counter(
+      state.thread_index() == 0 ? 0.0 : static_cast<double>(count * 64),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_MyPersistentVectorUpdate);
+BENCHMARK(BM_MyPersistentVectorBatchUpdate);
+BENCHMARK(BM_MyVectorCopyAndSwapUpdate);
+BENCHMARK(BM_MyPersistentVectorReaders)->Threads(4)->UseRealTime();
+BENCHMARK(BM_MyVectorCopyAndSwapReaders)->Threads(4)->UseRealTime();
+BENCHMARK_MAIN();
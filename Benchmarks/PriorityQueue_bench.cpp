@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <queue>
+
+#include "Benchmarks/Measure.hpp"
+#include "Benchmarks/PerfCounters.hpp"
+#include "Source/PriorityQueue.hpp"
+#include "Source/Vector.hpp"
+
+static uint64_t nextRandom(uint64_t& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static MySTL::Vector<uint64_t> randomValues(size_t count) {
+  MySTL::Vector<uint64_t> values;
+  values.reserve(count);
+
+  uint64_t state = 88172645463325252ull;
+  for (size_t i{}; i < count; ++i) {
+    values.push_back(nextRandom(state));
+  }
+
+  return values;
+}
+
+// Hold model: the queue stays at range(0) elements, every operation pops the top and pushes a
+// value slightly after it, like a timer queue or an event simulation
+template <typename Queue>
+static void pushPop(benchmark::State& state) {
+  uint64_t count = 0;
+
+  Queue queue;
+  for (uint64_t value : randomValues(static_cast<size_t>(state.range(0)))) {
+    queue.push(value >> 1);
+  }
+  uint64_t random = 0x2545F4914F6CDD1Dull;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      uint64_t top = queue.top();
+      queue.pop();
+      queue.push(top + (nextRandom(random) >> 40));
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+template <typename Queue>
+static void buildFromRange(benchmark::State& state, Queue& queue,
+                           const MySTL::Vector<uint64_t>& values);
+
+template <typename T, typename Compare, size_t Arity>
+static void buildFromRange(benchmark::State&, MySTL::PriorityQueue<T, Compare, Arity>& queue,
+                           const MySTL::Vector<uint64_t>& values) {
+  queue.push_range(values);
+}
+
+static void buildFromRange(benchmark::State&, std::priority_queue<uint64_t>& queue,
+                           const MySTL::Vector<uint64_t>& values) {
+  queue = std::priority_queue<uint64_t>(values.begin(), values.end());
+}
+
+template <typename Queue>
+static void bulkBuild(benchmark::State& state) {
+  MySTL::Vector<uint64_t> values = randomValues(static_cast<size_t>(state.range(0)));
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    Queue queue;
+    buildFromRange(state, queue, values);
+    benchmark::DoNotOptimize(queue.top());
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * values.size()));
+}
+
+using Entry = std::pair<uint64_t, uint32_t>;
+
+// Dijkstra-like relaxation: lower the key of a random queued element, pop the minimum every other
+// step and queue a new element for it. Without decrease_key std::priority_queue pushes a second
+// copy and skips the stale ones when they surface (lazy deletion).
+static void BM_MyIndexedPriorityQueueDecreaseKey(benchmark::State& state) {
+  uint64_t count = 0;
+  auto size = static_cast<size_t>(state.range(0));
+
+  MySTL::IndexedPriorityQueue<Entry, std::greater<Entry>> queue;
+  MySTL::Vector<MySTL::SlotHandle> handles;
+  MySTL::Vector<uint64_t> keys = randomValues(size);
+  for (uint32_t id{}; id < size; ++id) {
+    handles.push_back(queue.push({keys[id], id}));
+  }
+  uint64_t random = 0x2545F4914F6CDD1Dull;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      auto id = static_cast<uint32_t>(nextRandom(random) % size);
+      keys[id] -= keys[id] >> 4;
+      queue.decrease_key(handles[id], {keys[id], id});
+
+      if (count++ % 2 == 0) {
+        uint32_t popped = queue.top().second;
+        queue.pop();
+        keys[popped] = nextRandom(random);
+        handles[popped] = queue.push({keys[popped], popped});
+      }
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+  state.counters["final-size"] = static_cast<double>(queue.size());
+}
+
+static void BM_STDPriorityQueueLazyDecreaseKey(benchmark::State& state) {
+  uint64_t count = 0;
+  auto size = static_cast<size_t>(state.range(0));
+
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  MySTL::Vector<uint64_t> keys = randomValues(size);
+  for (uint32_t id{}; id < size; ++id) {
+    queue.push({keys[id], id});
+  }
+  uint64_t random = 0x2545F4914F6CDD1Dull;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      auto id = static_cast<uint32_t>(nextRandom(random) % size);
+      keys[id] -= keys[id] >> 4;
+      queue.push({keys[id], id});
+
+      if (count++ % 2 == 0) {
+        while (queue.top().first != keys[queue.top().second]) {
+          queue.pop();
+        }
+        uint32_t popped = queue.top().second;
+        queue.pop();
+        keys[popped] = nextRandom(random);
+        queue.push({keys[popped], popped});
+      }
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+  state.counters["final-size"] = static_cast<double>(queue.size());
+}
+
+static void BM_MyPriorityQueuePushPop(benchmark::State& state) {
+  pushPop<MySTL::PriorityQueue<uint64_t>>(state);
+}
+static void BM_MyBinaryPriorityQueuePushPop(benchmark::State& state) {
+  pushPop<MySTL::PriorityQueue<uint64_t, std::less<uint64_t>, 2>>(state);
+}
+static void BM_STDPriorityQueuePushPop(benchmark::State& state) {
+  pushPop<std::priority_queue<uint64_t>>(state);
+}
+static void BM_MyPriorityQueuePushRange(benchmark::State& state) {
+  bulkBuild<MySTL::PriorityQueue<uint64_t>>(state);
+}
+static void BM_STDPriorityQueueRangeConstruct(benchmark::State& state) {
+  bulkBuild<std::priority_queue<uint64_t>>(state);
+}
+
+BENCHMARK(BM_MyPriorityQueuePushPop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_MyBinaryPriorityQueuePushPop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_STDPriorityQueuePushPop)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_MyPriorityQueuePushRange)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_STDPriorityQueueRangeConstruct)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_MyIndexedPriorityQueueDecreaseKey)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK(BM_STDPriorityQueueLazyDecreaseKey)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <ranges>
+
+#include "Benchmarks/Measure.hpp"
+#include "Source/Ranges.hpp"
+#include "Source/Vector.hpp"
+
+// Pipeline under test: keep multiples of 3, map x -> x * x + 1, keep the first quarter of the
+// survivors. Every variant produces the same Vector.
+static constexpr auto keep = [](uint64_t x) { return x % 3 == 0; };
+static constexpr auto map = [](uint64_t x) { return x * x + 1; };
+
+static MySTL::Vector<uint64_t> makeInput(size_t count) {
+  MySTL::Vector<uint64_t> input;
+  input.reserve(count);
+
+  uint64_t state = 88172645463325252ull;
+  for (size_t i{}; i < count; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    input.push_back(state % 1000000);
+  }
+
+  return input;
+}
+
+template <typename Pipeline>
+static void runPipeline(benchmark::State& state, Pipeline pipeline) {
+  uint64_t count = 0;
+
+  MySTL::Vector<uint64_t> input = makeInput(static_cast<size_t>(state.range(0)));
+  size_t limit = input.size() / 12;
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::Vector<uint64_t> result = pipeline(input, limit);
+      benchmark::DoNotOptimize(&result[0]);
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+}
+
+static void BM_HandLoop(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t limit) {
+    MySTL::Vector<uint64_t> result;
+    for (uint64_t x : input) {
+      if (result.size() == limit) {
+        break;
+      }
+      if (keep(x)) {
+        result.push_back(map(x));
+      }
+    }
+    return result;
+  });
+}
+
+// One temporary Vector per stage, the way the transforms were written before the views
+static void BM_MyVectorMultiPass(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t limit) {
+    MySTL::Vector<uint64_t> filtered;
+    for (uint64_t x : input) {
+      if (keep(x)) {
+        filtered.push_back(x);
+      }
+    }
+
+    MySTL::Vector<uint64_t> mapped;
+    mapped.reserve(filtered.size());
+    for (uint64_t x : filtered) {
+      mapped.push_back(map(x));
+    }
+
+    MySTL::Vector<uint64_t> result;
+    for (size_t i{}; i < limit && i < mapped.size(); ++i) {
+      result.push_back(mapped[i]);
+    }
+    return result;
+  });
+}
+
+static void BM_MyViewsFused(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t limit) {
+    return input | MySTL::Views::filter(keep) | MySTL::Views::transform(map) |
+           MySTL::Views::take(limit) | MySTL::to<MySTL::Vector>();
+  });
+}
+
+static void BM_STDViewsFused(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t limit) {
+    MySTL::Vector<uint64_t> result;
+    for (uint64_t x : input | std::views::filter(keep) | std::views::transform(map) |
+                          std::views::take(limit)) {
+      result.push_back(x);
+    }
+    return result;
+  });
+}
+
+// Sized pipeline: to<Vector>() reserves once instead of growing
+static void BM_MyViewsTransformTo(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t) {
+    return input | MySTL::Views::transform(map) | MySTL::to<MySTL::Vector>();
+  });
+}
+
+static void BM_HandLoopTransformPushBack(benchmark::State& state) {
+  runPipeline(state, [](const MySTL::Vector<uint64_t>& input, size_t) {
+    MySTL::Vector<uint64_t> result;
+    for (uint64_t x : input) {
+      result.push_back(map(x));
+    }
+    return result;
+  });
+}
+
+BENCHMARK(BM_HandLoop)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MyVectorMultiPass)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MyViewsFused)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_STDViewsFused)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_MyViewsTransformTo)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_HandLoopTransformPushBack)->Range(1 << 10, 1 << 20);
+BENCHMARK_MAIN();
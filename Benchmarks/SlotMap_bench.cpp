@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+
+#include "Benchmarks/Measure.hpp"
+#include "Benchmarks/PerfCounters.hpp"
+#include "Source/SlotMap.hpp"
+#include "Source/Vector.hpp"
+
+// Entity sized like the components stored by the entity systems
+struct Entity {
+  float position[3];
+  float velocity[3];
+  uint64_t id;
+};
+
+static constexpr size_t EntityCount = 100000;
+
+// Vector with tombstones: erase marks the entry dead and pushes it on a free list
+struct TombstoneVector {
+  struct Entry {
+    Entity entity;
+    bool alive;
+  };
+
+  uint32_t insert(const Entity& entity) {
+    if (!freeList.empty()) {
+      uint32_t index = freeList.back();
+      freeList.pop_back();
+      entries[index] = Entry{entity, true};
+      return index;
+    }
+
+    entries.push_back(Entry{entity, true});
+    return static_cast<uint32_t>(entries.size() - 1);
+  }
+
+  void erase(uint32_t index) {
+    entries[index].alive = false;
+    freeList.push_back(index);
+  }
+
+  MySTL::Vector<Entry> entries;
+  MySTL::Vector<uint32_t> freeList;
+};
+
+static Entity makeEntity(uint64_t id) {
+  return Entity{{1.0f, 2.0f, 3.0f}, {0.5f, 0.5f, 0.5f}, id};
+}
+
+static void BM_MySlotMapChurn(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::SlotMap<Entity> map;
+  MySTL::Vector<MySTL::SlotHandle> handles;
+  for (size_t i{}; i < EntityCount; ++i) {
+    handles.push_back(map.insert(makeEntity(i)));
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      size_t victim = (count * 7919) % EntityCount;
+      map.erase(handles[victim]);
+      handles[victim] = map.insert(makeEntity(count++));
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_STDUnorderedMapChurn(benchmark::State& state) {
+  uint64_t count = 0;
+
+  std::unordered_map<uint64_t, Entity> map;
+  MySTL::Vector<uint64_t> keys;
+  uint64_t nextKey{};
+  for (size_t i{}; i < EntityCount; ++i) {
+    map.emplace(nextKey, makeEntity(i));
+    keys.push_back(nextKey++);
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      size_t victim = (count * 7919) % EntityCount;
+      map.erase(keys[victim]);
+      map.emplace(nextKey, makeEntity(count++));
+      keys[victim] = nextKey++;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_MyVectorTombstoneChurn(benchmark::State& state) {
+  uint64_t count = 0;
+
+  TombstoneVector vector;
+  MySTL::Vector<uint32_t> indices;
+  for (size_t i{}; i < EntityCount; ++i) {
+    indices.push_back(vector.insert(makeEntity(i)));
+  }
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      size_t victim = (count * 7919) % EntityCount;
+      vector.erase(indices[victim]);
+      indices[victim] = vector.insert(makeEntity(count++));
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+// Iteration after half of the entities were erased at random
+static void BM_MySlotMapIterate(benchmark::State& state) {
+  MySTL::SlotMap<Entity> map;
+  MySTL::Vector<MySTL::SlotHandle> handles;
+  for (size_t i{}; i < EntityCount; ++i) {
+    handles.push_back(map.insert(makeEntity(i)));
+  }
+  for (size_t i{}; i < EntityCount; i += 2) {
+    map.erase(handles[(i * 7919) % EntityCount]);
+  }
+
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    float sum{};
+    for (const Entity& entity : map) {
+      sum += entity.position[0] + entity.velocity[0];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.counters["live"] = static_cast<double>(map.size());
+}
+
+static void BM_STDUnorderedMapIterate(benchmark::State& state) {
+  std::unordered_map<uint64_t, Entity> map;
+  for (size_t i{}; i < EntityCount; ++i) {
+    map.emplace(i, makeEntity(i));
+  }
+  for (size_t i{}; i < EntityCount; i += 2) {
+    map.erase((i * 7919) % EntityCount);
+  }
+
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    float sum{};
+    for (const auto& [key, entity] : map) {
+      sum += entity.position[0] + entity.velocity[0];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.counters["live"] = static_cast<double>(map.size());
+}
+
+static void BM_MyVectorTombstoneIterate(benchmark::State& state) {
+  TombstoneVector vector;
+  for (size_t i{}; i < EntityCount; ++i) {
+    vector.insert(makeEntity(i));
+  }
+  for (size_t i{}; i < EntityCount; i += 2) {
+    vector.erase(static_cast<uint32_t>((i * 7919) % EntityCount));
+  }
+
+  MySTL::Bench::PerfCounters perf;
+
+  perf.start();
+  for (auto _ : state) {
+    float sum{};
+    for (const auto& entry : vector.entries) {
+      if (entry.alive) {
+        sum += entry.entity.position[0] + entry.entity.velocity[0];
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  perf.stop();
+
+  perf.report(state);
+  state.counters["live"] = static_cast<double>(vector.entries.size() - vector.freeList.size());
+}
+
+BENCHMARK(BM_MySlotMapChurn);
+BENCHMARK(BM_STDUnorderedMapChurn);
+BENCHMARK(BM_MyVectorTombstoneChurn);
+BENCHMARK(BM_MySlotMapIterate);
+BENCHMARK(BM_STDUnorderedMapIterate);
+BENCHMARK(BM_MyVectorTombstoneIterate);
+BENCHMARK_MAIN();
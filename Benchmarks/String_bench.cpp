@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "Benchmarks/Measure.hpp"
+#include "Source/String.hpp"
+#include "Source/Vector.hpp"
+
+// Typical service keys, all below the 23 character inline limit
+static const char* ShortStrings[] = {"user:42", "session-token", "GET /api/v1/items", "en-US",
+                                     "content-type", "2024-01-01T00:00:00"};
+static constexpr size_t ShortStringCount = std::size(ShortStrings);
+
+template <typename StringType>
+static void constructShort(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      StringType str(ShortStrings[count++ % ShortStringCount]);
+      benchmark::DoNotOptimize(str.data());
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+template <typename StringType>
+static void copy(benchmark::State& state) {
+  uint64_t count = 0;
+
+  StringType source(static_cast<size_t>(state.range(0)), 'x');
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      StringType str(source);
+      benchmark::DoNotOptimize(str.data());
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+template <typename StringType>
+static void append(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      StringType str;
+      for (size_t i{}; i < 16; ++i) {
+        str += ShortStrings[i % ShortStringCount];
+      }
+      benchmark::DoNotOptimize(str.data());
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+template <typename StringType>
+static void vectorGrowth(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      MySTL::Vector<StringType> strings;
+      for (size_t i{}; i < 4096; ++i) {
+        strings.emplace_back(ShortStrings[i % ShortStringCount]);
+      }
+      benchmark::DoNotOptimize(&strings[0]);
+      ++count;
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+// range(1) selects the filler: 'a' never starts a match, 'n' starts one at every position
+template <typename StringType>
+static void find(benchmark::State& state) {
+  StringType haystack(static_cast<size_t>(state.range(0)), static_cast<char>(state.range(1)));
+  haystack += "needle";
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(haystack.find("needle"));
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * haystack.size()));
+}
+
+static void BM_MyStringConstructShort(benchmark::State& state) {
+  constructShort<MySTL::String>(state);
+}
+static void BM_STDStringConstructShort(benchmark::State& state) {
+  constructShort<std::string>(state);
+}
+static void BM_MyStringCopy(benchmark::State& state) { copy<MySTL::String>(state); }
+static void BM_STDStringCopy(benchmark::State& state) { copy<std::string>(state); }
+static void BM_MyStringAppend(benchmark::State& state) { append<MySTL::String>(state); }
+static void BM_STDStringAppend(benchmark::State& state) { append<std::string>(state); }
+static void BM_MyStringVectorGrowth(benchmark::State& state) { vectorGrowth<MySTL::String>(state); }
+static void BM_STDStringVectorGrowth(benchmark::State& state) { vectorGrowth<std::string>(state); }
+static void BM_MyStringFind(benchmark::State& state) { find<MySTL::String>(state); }
+static void BM_STDStringFind(benchmark::State& state) { find<std::string>(state); }
+
+BENCHMARK(BM_MyStringConstructShort);
+BENCHMARK(BM_STDStringConstructShort);
+BENCHMARK(BM_MyStringCopy)->Arg(16)->Arg(64);
+BENCHMARK(BM_STDStringCopy)->Arg(16)->Arg(64);
+BENCHMARK(BM_MyStringAppend);
+BENCHMARK(BM_STDStringAppend);
+BENCHMARK(BM_MyStringVectorGrowth);
+BENCHMARK(BM_STDStringVectorGrowth);
+BENCHMARK(BM_MyStringFind)->ArgsProduct({{64, 4096}, {'a', 'n'}});
+BENCHMARK(BM_STDStringFind)->ArgsProduct({{64, 4096}, {'a', 'n'}});
+BENCHMARK_MAIN();
@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+
+#include "Benchmarks/PerfCounters.hpp"
+#include "Source/ThreadCachingAllocator.hpp"
+#include "Source/UniquePointer.hpp"
+#include "Source/Vector.hpp"
+
+// HeapProfile is left out on purpose: its shared counters would serialise the threads and hide
+// exactly the contention these benchmarks are about.
+
+static constexpr size_t LiveBlocks = 256;
+static constexpr size_t SharedSlots = 1024;
+static constexpr size_t SharedBlockSize = 64;
+
+static uint64_t nextRandom(uint64_t& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static uint64_t threadSeed(const benchmark::State& state) {
+  return 88172645463325252ull + static_cast<uint64_t>(state.thread_index()) * 0x9E3779B97F4A7C15ull;
+}
+
+static void reportRate(benchmark::State& state, MySTL::Bench::PerfCounters& perf, uint64_t count) {
+  perf.stop();
+  perf.report(state);
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+// Every thread keeps LiveBlocks blocks of 16 to 512 bytes alive and replaces a random one per
+// iteration, so allocations and frees of mixed sizes interleave without ever leaving the thread
+template <typename Allocator>
+static void churn(benchmark::State& state) {
+  Allocator alloc;
+  uint64_t random = threadSeed(state);
+  uint64_t count = 0;
+
+  char* blocks[LiveBlocks];
+  size_t sizes[LiveBlocks];
+  for (size_t i{}; i < LiveBlocks; ++i) {
+    sizes[i] = 16 + nextRandom(random) % 497;
+    blocks[i] = alloc.allocate(sizes[i]);
+  }
+
+  MySTL::Bench::PerfCounters perf;
+  perf.start();
+  for (auto _ : state) {
+    uint64_t value = nextRandom(random);
+    size_t slot = value % LiveBlocks;
+
+    alloc.deallocate(blocks[slot], sizes[slot]);
+    sizes[slot] = 16 + (value >> 32) % 497;
+    blocks[slot] = alloc.allocate(sizes[slot]);
+    blocks[slot][0] = static_cast<char>(count++);
+  }
+  reportRate(state, perf, count);
+
+  for (size_t i{}; i < LiveBlocks; ++i) {
+    alloc.deallocate(blocks[i], sizes[i]);
+  }
+}
+
+// Threads swap freshly allocated blocks into shared slots and free whatever they take out, which
+// was usually allocated by another thread. The slots stay filled between runs.
+template <typename Allocator>
+static std::atomic<char*>* sharedSlots() {
+  static std::atomic<char*> slots[SharedSlots]{};
+  return slots;
+}
+
+template <typename Allocator>
+static void crossThreadChurn(benchmark::State& state) {
+  Allocator alloc;
+  std::atomic<char*>* slots = sharedSlots<Allocator>();
+  uint64_t random = threadSeed(state);
+  uint64_t count = 0;
+
+  MySTL::Bench::PerfCounters perf;
+  perf.start();
+  for (auto _ : state) {
+    char* block = alloc.allocate(SharedBlockSize);
+    block[0] = static_cast<char>(count++);
+
+    char* previous = slots[nextRandom(random) % SharedSlots].exchange(block);
+    if (previous != nullptr) {
+      alloc.deallocate(previous, SharedBlockSize);
+    }
+  }
+  reportRate(state, perf, count);
+}
+
+// Short-lived vectors of 1 to 64 elements, the pattern that sends small blocks through the
+// allocator at the highest rate
+template <typename Allocator>
+static void vectorChurn(benchmark::State& state) {
+  uint64_t random = threadSeed(state);
+  uint64_t count = 0;
+
+  MySTL::Bench::PerfCounters perf;
+  perf.start();
+  for (auto _ : state) {
+    MySTL::Vector<uint64_t, Allocator> vector;
+    size_t size = 1 + nextRandom(random) % 64;
+    for (size_t i{}; i < size; ++i) {
+      vector.push_back(i);
+    }
+    benchmark::DoNotOptimize(vector.back());
+    ++count;
+  }
+  reportRate(state, perf, count);
+}
+
+struct Payload {
+  uint64_t values[4];
+};
+
+template <typename Allocator>
+static void uniquePointerChurn(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::PerfCounters perf;
+  perf.start();
+  for (auto _ : state) {
+    auto p = MySTL::allocate_unique<Payload>(Allocator(), Payload{{count++, 0, 0, 0}});
+    benchmark::DoNotOptimize(p.get());
+  }
+  reportRate(state, perf, count);
+}
+
+static void BM_MyThreadCachingAllocatorChurn(benchmark::State& state) {
+  churn<MySTL::ThreadCachingAllocator<char>>(state);
+}
+static void BM_STDAllocatorChurn(benchmark::State& state) {
+  churn<std::allocator<char>>(state);
+}
+static void BM_MyThreadCachingAllocatorCrossThreadChurn(benchmark::State& state) {
+  crossThreadChurn<MySTL::ThreadCachingAllocator<char>>(state);
+}
+static void BM_STDAllocatorCrossThreadChurn(benchmark::State& state) {
+  crossThreadChurn<std::allocator<char>>(state);
+}
+static void BM_MyThreadCachingAllocatorVectorChurn(benchmark::State& state) {
+  vectorChurn<MySTL::ThreadCachingAllocator<uint64_t>>(state);
+}
+static void BM_STDAllocatorVectorChurn(benchmark::State& state) {
+  vectorChurn<std::allocator<uint64_t>>(state);
+}
+static void BM_MyThreadCachingAllocatorAllocateUnique(benchmark::State& state) {
+  uniquePointerChurn<MySTL::ThreadCachingAllocator<Payload>>(state);
+}
+static void BM_STDAllocatorAllocateUnique(benchmark::State& state) {
+  uniquePointerChurn<std::allocator<Payload>>(state);
+}
+
+BENCHMARK(BM_MyThreadCachingAllocatorChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_STDAllocatorChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MyThreadCachingAllocatorCrossThreadChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_STDAllocatorCrossThreadChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MyThreadCachingAllocatorVectorChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_STDAllocatorVectorChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MyThreadCachingAllocatorAllocateUnique)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_STDAllocatorAllocateUnique)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_MAIN();
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "Benchmarks/Measure.hpp"
+#include "Source/UniquePointer.hpp"
+
+struct Payload {
+  uint64_t values[4];
+};
+
+static void BM_MyUniquePointer(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      auto p = MySTL::make_unique<Payload>(Payload{{count++, 0, 0, 0}});
+      benchmark::DoNotOptimize(p.get());
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_STDUniquePointer(benchmark::State& state) {
+  uint64_t count = 0;
+
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      auto p = std::make_unique<Payload>(Payload{{count++, 0, 0, 0}});
+      benchmark::DoNotOptimize(p.get());
+    }
+  });
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_MyUniquePointer)->Unit(benchmark::kSecond)->Repetitions(5);
+BENCHMARK(BM_STDUniquePointer)->Unit(benchmark::kSecond)->Repetitions(5);
+BENCHMARK_MAIN();
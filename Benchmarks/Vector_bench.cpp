@@ -2,18 +2,21 @@
 
 #include <vector>
 
+#include "Benchmarks/HeapProfile.hpp"
+#include "Benchmarks/Measure.hpp"
 #include "Source/Vector.hpp"
 
 static void BM_MyVector(benchmark::State& state) {
   uint64_t count = 0;
 
   MySTL::Vector<int> v;
-
-  for (auto _ : state) {
-    v.push_back(count++);
-    (void)v.at(static_cast<int>(count / 2));
-  }
-
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      v.push_back(count++);
+      (void)v.at(static_cast<int>(count / 2));
+    }
+  });
+  MySTL::Bench::HeapProfile::reportUtilization(state, v);
   state.counters["ops/sec"] =
       benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
 }
@@ -22,16 +25,47 @@ static void BM_STDVector(benchmark::State& state) {
   uint64_t count = 0;
 
   std::vector<int> v;
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      v.push_back(count++);
+      (void)v.at(static_cast<int>(count / 2));
+    }
+  });
+  MySTL::Bench::HeapProfile::reportUtilization(state, v);
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
+
+static void BM_MyVectorInsert(benchmark::State& state) {
+  uint64_t count = 0;
 
-  for (auto _ : state) {
-    v.push_back(count++);
-    (void)v.at(static_cast<int>(count / 2));
-  }
+  MySTL::Vector<int> v;
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      v.insert(v.size() / 2, static_cast<int>(count++));
+    }
+  });
+  MySTL::Bench::HeapProfile::reportUtilization(state, v);
+  state.counters["ops/sec"] =
+      benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
+}
 
+static void BM_STDVectorInsert(benchmark::State& state) {
+  uint64_t count = 0;
+
+  std::vector<int> v;
+  MySTL::Bench::measure(state, [&] {
+    for (auto _ : state) {
+      v.insert(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2), static_cast<int>(count++));
+    }
+  });
+  MySTL::Bench::HeapProfile::reportUtilization(state, v);
   state.counters["ops/sec"] =
       benchmark::Counter(static_cast<double>(count), benchmark::Counter::kIsRate);
 }
 
 BENCHMARK(BM_MyVector)->Unit(benchmark::kSecond)->Repetitions(5);
 BENCHMARK(BM_STDVector)->Unit(benchmark::kSecond)->Repetitions(5);
+BENCHMARK(BM_MyVectorInsert)->Iterations(10000);
+BENCHMARK(BM_STDVectorInsert)->Iterations(10000);
 BENCHMARK_MAIN();
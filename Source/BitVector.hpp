@@ -0,0 +1,407 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Source/Vector.hpp"
+
+namespace MySTL {
+
+namespace Detail {
+
+// Four independent accumulators keep the popcount units busy
+[[gnu::always_inline]] inline size_t popcountLoop(const uint64_t* words, size_t count) noexcept {
+  size_t c0{}, c1{}, c2{}, c3{};
+  size_t i{};
+
+  for (; i + 4 <= count; i += 4) {
+    c0 += std::popcount(words[i]);
+    c1 += std::popcount(words[i + 1]);
+    c2 += std::popcount(words[i + 2]);
+    c3 += std::popcount(words[i + 3]);
+  }
+
+  for (; i < count; ++i) {
+    c0 += std::popcount(words[i]);
+  }
+
+  return c0 + c1 + c2 + c3;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__POPCNT__)
+// Baseline x86-64 lowers std::popcount to a libgcc call (__popcountdi2). This copy of the loop is
+// compiled for the POPCNT instruction and picked at run time when the CPU has it.
+[[gnu::target("popcnt")]] inline size_t popcountLoopHardware(const uint64_t* words,
+                                                             size_t count) noexcept {
+  return popcountLoop(words, count);
+}
+
+[[nodiscard]] inline bool hasHardwarePopcount() noexcept {
+  static const bool supported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt") != 0;
+  }();
+  return supported;
+}
+#endif
+
+// Set bits in words[0, count). Single words call std::popcount directly: for one word the dispatch
+// costs more than the instruction saves.
+[[nodiscard]] inline size_t popcountWords(const uint64_t* words, size_t count) noexcept {
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__POPCNT__)
+  if (hasHardwarePopcount()) {
+    return popcountLoopHardware(words, count);
+  }
+#endif
+  return popcountLoop(words, count);
+}
+
+}  // namespace Detail
+
+// Dynamic bitset packed 64 flags per word. Bulk operations work a word at a time and bits past
+// size() in the last word are always kept at zero, so count/find never need to mask them.
+//
+// rank(pos) is O(1) once buildRankIndex() has been called (a cumulative count every 512 bits).
+// select(k) uses the same index plus a sample of every 4096th set bit, see select() for its bound.
+// Any mutation drops the index, rank/select then fall back to scanning the words.
+class BitVector {
+ public:
+  using word_type = uint64_t;
+  using size_type = size_t;
+
+  static constexpr size_t npos = static_cast<size_t>(-1);
+  static constexpr size_t WordBits = 64;
+
+  BitVector() noexcept = default;
+
+  explicit BitVector(size_t count, bool value = false) { resize(count, value); }
+
+  [[nodiscard]] bool operator[](size_t pos) const noexcept { return test(pos); }
+
+  [[nodiscard]] bool test(size_t pos) const noexcept {
+    return (m_words[pos / WordBits] >> (pos % WordBits)) & 1;
+  }
+
+  [[nodiscard]] bool at(size_t pos) const {
+    if (pos >= m_size) {
+      throw std::runtime_error("MySTL::BitVector: Index out of bound");
+    }
+
+    return test(pos);
+  }
+
+  BitVector& set(size_t pos, bool value = true) noexcept {
+    word_type mask = word_type{1} << (pos % WordBits);
+    word_type& word = m_words[pos / WordBits];
+    word = value ? (word | mask) : (word & ~mask);
+    m_rankValid = false;
+    return *this;
+  }
+
+  BitVector& reset(size_t pos) noexcept { return set(pos, false); }
+
+  BitVector& flip(size_t pos) noexcept {
+    m_words[pos / WordBits] ^= word_type{1} << (pos % WordBits);
+    m_rankValid = false;
+    return *this;
+  }
+
+  BitVector& set() noexcept {
+    for (size_t i{}; i < m_words.size(); ++i) {
+      m_words[i] = ~word_type{0};
+    }
+
+    clearPadding();
+    return *this;
+  }
+
+  BitVector& reset() noexcept {
+    for (size_t i{}; i < m_words.size(); ++i) {
+      m_words[i] = 0;
+    }
+
+    m_rankValid = false;
+    return *this;
+  }
+
+  BitVector& flip() noexcept {
+    for (size_t i{}; i < m_words.size(); ++i) {
+      m_words[i] = ~m_words[i];
+    }
+
+    clearPadding();
+    return *this;
+  }
+
+  void resize(size_t count, bool value = false) {
+    size_t words = wordsFor(count);
+
+    while (m_words.size() > words) {
+      m_words.pop_back();
+    }
+
+    // Bits between the old size and the end of its last word are zero by invariant
+    if (value && m_size < count && m_size % WordBits != 0) {
+      m_words.back() |= ~word_type{0} << (m_size % WordBits);
+    }
+
+    m_words.reserve(words);
+    while (m_words.size() < words) {
+      m_words.push_back(value ? ~word_type{0} : 0);
+    }
+
+    m_size = count;
+    clearPadding();
+  }
+
+  void push_back(bool value) {
+    if (m_size % WordBits == 0) {
+      m_words.push_back(0);
+    }
+
+    ++m_size;
+    set(m_size - 1, value);
+  }
+
+  void pop_back() noexcept {
+    if (m_size == 0) {
+      return;
+    }
+
+    resize(m_size - 1);
+  }
+
+  void clear() noexcept {
+    m_words.clear();
+    m_size = 0;
+    m_rankValid = false;
+  }
+
+  BitVector& operator&=(const BitVector& other) noexcept {
+    for (size_t i{}; i < m_words.size(); ++i) {
+      m_words[i] &= i < other.m_words.size() ? other.m_words[i] : 0;
+    }
+
+    m_rankValid = false;
+    return *this;
+  }
+
+  BitVector& operator|=(const BitVector& other) noexcept {
+    size_t words = m_words.size() < other.m_words.size() ? m_words.size() : other.m_words.size();
+    for (size_t i{}; i < words; ++i) {
+      m_words[i] |= other.m_words[i];
+    }
+
+    clearPadding();
+    return *this;
+  }
+
+  BitVector& operator^=(const BitVector& other) noexcept {
+    size_t words = m_words.size() < other.m_words.size() ? m_words.size() : other.m_words.size();
+    for (size_t i{}; i < words; ++i) {
+      m_words[i] ^= other.m_words[i];
+    }
+
+    clearPadding();
+    return *this;
+  }
+
+  [[nodiscard]] BitVector operator~() const {
+    BitVector result(*this);
+    result.flip();
+    return result;
+  }
+
+  // Number of set bits. Uses the POPCNT instruction when the CPU has it, even in builds without
+  // -mpopcnt.
+  [[nodiscard]] size_t count() const noexcept {
+    return Detail::popcountWords(words(), m_words.size());
+  }
+
+  [[nodiscard]] bool any() const noexcept { return find_first() != npos; }
+  [[nodiscard]] bool none() const noexcept { return !any(); }
+  [[nodiscard]] bool all() const noexcept { return count() == m_size; }
+
+  [[nodiscard]] size_t find_first() const noexcept { return findFromWord(0); }
+
+  // First set bit strictly after pos, or npos.
+  [[nodiscard]] size_t find_next(size_t pos) const noexcept {
+    // Checked before the increment, which would wrap npos around to 0
+    if (pos >= m_size || pos + 1 == m_size) {
+      return npos;
+    }
+    ++pos;
+
+    size_t index = pos / WordBits;
+    word_type word = m_words[index] & (~word_type{0} << (pos % WordBits));
+    if (word) {
+      return index * WordBits + std::countr_zero(word);
+    }
+
+    return findFromWord(index + 1);
+  }
+
+  void buildRankIndex() {
+    m_rankIndex.clear();
+    m_selectIndex.clear();
+    m_rankIndex.reserve(m_words.size() / WordsPerBlock + 1);
+
+    size_t total{};
+    for (size_t first{}; first < m_words.size(); first += WordsPerBlock) {
+      size_t block = first / WordsPerBlock;
+      m_rankIndex.push_back(total);
+      size_t blockWords = std::min(WordsPerBlock, m_words.size() - first);
+      total += Detail::popcountWords(&m_words[first], blockWords);
+
+      // Block holding each SelectSample-th set bit
+      while (m_selectIndex.size() * SelectSample < total) {
+        m_selectIndex.push_back(block);
+      }
+    }
+
+    m_rankIndex.push_back(total);
+    m_rankValid = true;
+  }
+
+  [[nodiscard]] bool hasRankIndex() const noexcept { return m_rankValid; }
+
+  // Number of set bits in [0, pos).
+  [[nodiscard]] size_t rank(size_t pos) const noexcept {
+    if (pos >= m_size) {
+      return m_rankValid ? m_rankIndex.back() : count();
+    }
+
+    size_t index = pos / WordBits;
+    size_t first = m_rankValid ? index - index % WordsPerBlock : 0;
+    size_t total = m_rankValid ? m_rankIndex[index / WordsPerBlock] : 0;
+    total += Detail::popcountWords(&m_words[first], index - first);
+
+    word_type mask = (word_type{1} << (pos % WordBits)) - 1;
+    return total + static_cast<size_t>(std::popcount(m_words[index] & mask));
+  }
+
+  // Position of the k-th set bit (0 based), or npos when there are not enough set bits.
+  //
+  // With the index this is not O(1): the select sample narrows the search to the blocks between two
+  // sampled set bits, which are binary searched, so the cost is O(log(blocks between samples)).
+  // That is at most 4 steps at 50% density but grows to O(log(n / 512)) for very sparse vectors.
+  // Without the index it scans the words, O(n).
+  [[nodiscard]] size_t select(size_t k) const noexcept {
+    size_t word = 0;
+    size_t remaining = k;
+
+    if (m_rankValid) {
+      if (k >= m_rankIndex.back()) {
+        return npos;
+      }
+
+      // Last block whose cumulative count is <= k, between the samples around k
+      size_t sample = k / SelectSample;
+      size_t lo = m_selectIndex[sample];
+      size_t hi = sample + 1 < m_selectIndex.size() ? m_selectIndex[sample + 1] + 1
+                                                    : m_rankIndex.size() - 1;
+      while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (m_rankIndex[mid] <= k) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+
+      word = lo * WordsPerBlock;
+      remaining = k - m_rankIndex[lo];
+    }
+
+    for (; word < m_words.size(); ++word) {
+      size_t bits = static_cast<size_t>(std::popcount(m_words[word]));
+      if (remaining < bits) {
+        return word * WordBits + selectInWord(m_words[word], remaining);
+      }
+
+      remaining -= bits;
+    }
+
+    return npos;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+  [[nodiscard]] size_t size() const noexcept { return m_size; }
+  [[nodiscard]] size_t capacity() const noexcept { return m_words.capacity() * WordBits; }
+
+  [[nodiscard]] size_t num_words() const noexcept { return m_words.size(); }
+  [[nodiscard]] const word_type* words() const noexcept {
+    return m_words.empty() ? nullptr : &m_words[0];
+  }
+
+  [[nodiscard]] bool operator==(const BitVector& other) const noexcept {
+    if (m_size != other.m_size) {
+      return false;
+    }
+
+    for (size_t i{}; i < m_words.size(); ++i) {
+      if (m_words[i] != other.m_words[i]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  static constexpr size_t WordsPerBlock = 8;
+  static constexpr size_t SelectSample = 4096;
+
+  static constexpr size_t wordsFor(size_t bits) noexcept { return (bits + WordBits - 1) / WordBits; }
+
+  static size_t selectInWord(word_type word, size_t k) noexcept {
+    for (size_t i{}; i < k; ++i) {
+      word &= word - 1;
+    }
+
+    return std::countr_zero(word);
+  }
+
+  [[nodiscard]] size_t findFromWord(size_t index) const noexcept {
+    for (; index < m_words.size(); ++index) {
+      if (m_words[index]) {
+        return index * WordBits + std::countr_zero(m_words[index]);
+      }
+    }
+
+    return npos;
+  }
+
+  void clearPadding() noexcept {
+    if (m_size % WordBits != 0) {
+      m_words.back() &= (word_type{1} << (m_size % WordBits)) - 1;
+    }
+
+    m_rankValid = false;
+  }
+
+  Vector<word_type> m_words;
+  Vector<size_t> m_rankIndex;
+  Vector<size_t> m_selectIndex;
+  size_t m_size{};
+  bool m_rankValid{false};
+};
+
+[[nodiscard]] inline BitVector operator&(BitVector lhs, const BitVector& rhs) {
+  lhs &= rhs;
+  return lhs;
+}
+
+[[nodiscard]] inline BitVector operator|(BitVector lhs, const BitVector& rhs) {
+  lhs |= rhs;
+  return lhs;
+}
+
+[[nodiscard]] inline BitVector operator^(BitVector lhs, const BitVector& rhs) {
+  lhs ^= rhs;
+  return lhs;
+}
+
+}  // namespace MySTL
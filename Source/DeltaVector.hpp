@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Source/InplaceVector.hpp"
+#include "Source/PackedIntVector.hpp"
+#include "Source/Vector.hpp"
+
+namespace MySTL {
+
+// Non-decreasing sequence of unsigned integers (IDs, timestamps) stored as the gaps between
+// neighbours. Every block of 128 values packs its gaps with the bit width of the largest one, using
+// the PackedIntVector block layout, so dense sequences take a few bits per value.
+//
+// The skip index keeps the first value of each block: lower_bound/contains binary search it and
+// decode a single block. get(i) decodes the block prefix, O(BlockSize). The newest values wait
+// uncompressed in a tail until a block is full.
+class DeltaVector {
+ public:
+  using value_type = uint64_t;
+  using size_type = size_t;
+
+  static constexpr size_t BlockSize = Detail::PackedBlockSize;
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  DeltaVector() noexcept = default;
+
+  void push_back(uint64_t value) {
+    if (!empty() && value < m_back) {
+      throw std::runtime_error("MySTL::DeltaVector: Values must be pushed in non-decreasing order");
+    }
+
+    m_tail.unchecked_push_back(value);
+    m_back = value;
+
+    if (m_tail.full()) {
+      sealTail();
+    }
+  }
+
+  [[nodiscard]] uint64_t get(size_t index) const noexcept {
+    size_t blockIndex = index / BlockSize;
+    if (blockIndex == m_blockFirst.size()) {
+      return m_tail[index % BlockSize];
+    }
+
+    uint64_t gaps[BlockSize];
+    unpackGaps(blockIndex, gaps);
+
+    uint64_t value = m_blockFirst[blockIndex];
+    for (size_t i{1}; i <= index % BlockSize; ++i) {
+      value += gaps[i];
+    }
+
+    return value;
+  }
+
+  [[nodiscard]] uint64_t operator[](size_t index) const noexcept { return get(index); }
+
+  [[nodiscard]] uint64_t at(size_t index) const {
+    if (index >= size()) {
+      throw std::runtime_error("MySTL::DeltaVector: Index out of bound");
+    }
+
+    return get(index);
+  }
+
+  [[nodiscard]] uint64_t back() const noexcept { return m_back; }
+
+  // Writes the BlockSize values of a sealed block to out
+  void decodeBlock(size_t blockIndex, uint64_t* out) const noexcept {
+    unpackGaps(blockIndex, out);
+
+    out[0] = m_blockFirst[blockIndex];
+    for (size_t i{1}; i < BlockSize; ++i) {
+      out[i] += out[i - 1];
+    }
+  }
+
+  // Writes values [first, first + count) to out
+  void decode(size_t first, size_t count, uint64_t* out) const noexcept {
+    uint64_t buffer[BlockSize];
+
+    while (count > 0) {
+      size_t blockIndex = first / BlockSize;
+      size_t offset = first % BlockSize;
+      size_t length = std::min(BlockSize - offset, count);
+
+      if (blockIndex == m_blockFirst.size()) {
+        std::copy_n(m_tail.data() + offset, length, out);
+      } else if (length == BlockSize) {
+        decodeBlock(blockIndex, out);
+      } else {
+        decodeBlock(blockIndex, buffer);
+        std::copy_n(buffer + offset, length, out);
+      }
+
+      first += length;
+      count -= length;
+      out += length;
+    }
+  }
+
+  // Position of the first value not less than value, size() when there is none
+  [[nodiscard]] size_t lower_bound(uint64_t value) const noexcept {
+    size_t blockIndex = static_cast<size_t>(
+        std::lower_bound(m_blockFirst.begin(), m_blockFirst.end(), value) - m_blockFirst.begin());
+
+    // Values of the block before the first one starting at or above value may still qualify
+    if (blockIndex > 0) {
+      uint64_t buffer[BlockSize];
+      decodeBlock(blockIndex - 1, buffer);
+
+      const uint64_t* hit = std::lower_bound(buffer, buffer + BlockSize, value);
+      if (hit != buffer + BlockSize) {
+        return (blockIndex - 1) * BlockSize + static_cast<size_t>(hit - buffer);
+      }
+    }
+
+    if (blockIndex < m_blockFirst.size()) {
+      return blockIndex * BlockSize;
+    }
+
+    return m_blockFirst.size() * BlockSize +
+           static_cast<size_t>(std::lower_bound(m_tail.begin(), m_tail.end(), value) -
+                               m_tail.begin());
+  }
+
+  [[nodiscard]] bool contains(uint64_t value) const noexcept {
+    size_t index = lower_bound(value);
+    return index < size() && get(index) == value;
+  }
+
+  void clear() noexcept {
+    m_words.clear();
+    m_blockFirst.clear();
+    m_blockLayout.clear();
+    m_tail.clear();
+    m_back = 0;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] size_t size() const noexcept {
+    return m_blockFirst.size() * BlockSize + m_tail.size();
+  }
+  [[nodiscard]] size_t num_blocks() const noexcept { return m_blockFirst.size(); }
+  [[nodiscard]] size_t num_words() const noexcept { return m_words.size(); }
+
+  // Bytes of packed gaps, skip index and tail, to compare against size() * sizeof(uint64_t)
+  [[nodiscard]] size_t storageBytes() const noexcept {
+    return (m_words.size() + m_blockFirst.size() + m_blockLayout.size()) * sizeof(uint64_t) +
+           sizeof(m_tail);
+  }
+
+ private:
+  static constexpr unsigned WidthBits = 8;
+
+  void sealTail() {
+    uint64_t maxGap{};
+    for (size_t i{1}; i < BlockSize; ++i) {
+      maxGap = std::max(maxGap, m_tail[i] - m_tail[i - 1]);
+    }
+
+    auto width = static_cast<unsigned>(std::bit_width(maxGap));
+
+    // Reuse the two trailing zero words as the start of this block, then restore them at the end
+    if (m_words.empty()) {
+      m_words.push_back(0);
+      m_words.push_back(0);
+    }
+    size_t offset = m_words.size() - 2;
+    for (size_t i{}; i < 2 * size_t{width}; ++i) {
+      m_words.push_back(0);
+    }
+
+    if (width > 0) {
+      for (size_t i{1}; i < BlockSize; ++i) {
+        Detail::packedSet(&m_words[offset], width, i, m_tail[i] - m_tail[i - 1]);
+      }
+    }
+
+    m_blockFirst.push_back(m_tail[0]);
+    m_blockLayout.push_back(offset << WidthBits | width);
+    m_tail.clear();
+  }
+
+  // Gap to the previous value for every position of the block, 0 for the first one
+  void unpackGaps(size_t blockIndex, uint64_t* out) const noexcept {
+    uint64_t layout = m_blockLayout[blockIndex];
+    unsigned width = layout & ((1u << WidthBits) - 1);
+    Detail::UnpackBlockTable[width](&m_words[layout >> WidthBits], out);
+  }
+
+  Vector<uint64_t> m_words;
+  Vector<uint64_t> m_blockFirst;
+  Vector<uint64_t> m_blockLayout;  // word offset << WidthBits | bit width
+  InplaceVector<uint64_t, BlockSize> m_tail;
+  uint64_t m_back{};
+};
+
+}  // namespace MySTL
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MySTL {
+
+// Fixed capacity vector that keeps its elements inline and never touches the heap, following the
+// C++26 std::inplace_vector semantics. Copy, move and destruction are trivial when T's are, so an
+// InplaceVector of trivially copyable T is itself trivially copyable and usable in constexpr.
+template <typename T, size_t N>
+class InplaceVector {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using Iterator = T*;
+  using ConstIterator = const T*;
+
+  static_assert(N > 0, "InplaceVector capacity must be greater than zero");
+
+  constexpr InplaceVector() noexcept {
+    // A constant expression result must be fully initialized, runtime storage stays untouched
+    if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>) {
+      if (std::is_constant_evaluated()) {
+        for (size_t i{}; i < N; ++i) {
+          m_data[i] = T();
+        }
+      }
+    }
+  }
+
+  explicit constexpr InplaceVector(size_t count, const T& item) : InplaceVector() {
+    if (count > N) {
+      throw std::bad_alloc();
+    }
+
+    for (size_t i{}; i < count; ++i) {
+      unchecked_push_back(item);
+    }
+  }
+
+  constexpr InplaceVector(std::initializer_list<T> items) : InplaceVector() {
+    if (items.size() > N) {
+      throw std::bad_alloc();
+    }
+
+    for (auto&& item : items) {
+      unchecked_push_back(item);
+    }
+  }
+
+  constexpr InplaceVector(const InplaceVector&)
+    requires std::is_trivially_copy_constructible_v<T>
+  = default;
+
+  constexpr InplaceVector(const InplaceVector& other) noexcept(
+      std::is_nothrow_copy_constructible_v<T>)
+      : InplaceVector() {
+    for (size_t i{}; i < other.m_size; ++i) {
+      unchecked_push_back(other.m_data[i]);
+    }
+  }
+
+  constexpr InplaceVector(InplaceVector&&)
+    requires std::is_trivially_move_constructible_v<T>
+  = default;
+
+  constexpr InplaceVector(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : InplaceVector() {
+    for (size_t i{}; i < other.m_size; ++i) {
+      unchecked_push_back(std::move(other.m_data[i]));
+    }
+  }
+
+  constexpr ~InplaceVector()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+
+  constexpr ~InplaceVector() { clear(); }
+
+  constexpr InplaceVector& operator=(const InplaceVector&)
+    requires std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T> &&
+             std::is_trivially_destructible_v<T>
+  = default;
+
+  constexpr InplaceVector& operator=(const InplaceVector& other) {
+    if (&other == this) {
+      return *this;
+    }
+
+    clear();
+
+    for (size_t i{}; i < other.m_size; ++i) {
+      unchecked_push_back(other.m_data[i]);
+    }
+
+    return *this;
+  }
+
+  constexpr InplaceVector& operator=(InplaceVector&&)
+    requires std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T> &&
+             std::is_trivially_destructible_v<T>
+  = default;
+
+  constexpr InplaceVector& operator=(InplaceVector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (&other == this) {
+      return *this;
+    }
+
+    clear();
+
+    for (size_t i{}; i < other.m_size; ++i) {
+      unchecked_push_back(std::move(other.m_data[i]));
+    }
+
+    return *this;
+  }
+
+  constexpr InplaceVector& operator=(std::initializer_list<T> items) {
+    if (items.size() > N) {
+      throw std::bad_alloc();
+    }
+
+    clear();
+
+    for (auto&& item : items) {
+      unchecked_push_back(item);
+    }
+
+    return *this;
+  }
+
+  // Only checks the requested size, storage is always N elements.
+  static constexpr void reserve(size_t capacity) {
+    if (capacity > N) {
+      throw std::bad_alloc();
+    }
+  }
+
+  static constexpr void shrink_to_fit() noexcept {}
+
+  constexpr void resize(size_t size) {
+    if (size > N) {
+      throw std::bad_alloc();
+    }
+
+    while (m_size > size) {
+      pop_back();
+    }
+
+    while (m_size < size) {
+      unchecked_emplace_back();
+    }
+  }
+
+  constexpr void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_t i{}; i < m_size; ++i) {
+        std::destroy_at(m_data + i);
+      }
+    }
+
+    m_size = 0;
+  }
+
+  constexpr Iterator insert(size_t pos, size_t count, const T& value) {
+    if (pos > m_size || m_size + count > N) {
+      throw std::bad_alloc();
+    }
+
+    if (count == 0) {
+      return m_data + pos;
+    }
+
+    // Copy first, value may live inside the range we are about to shift
+    T copy(value);
+
+    for (size_t i{m_size}; i > pos; --i) {
+      constructAt(i - 1 + count, std::move(m_data[i - 1]));
+      destroyAt(i - 1);
+    }
+
+    for (size_t i{}; i < count; ++i) {
+      constructAt(pos + i, copy);
+    }
+
+    m_size += count;
+    return m_data + pos;
+  }
+
+  constexpr Iterator insert(size_t pos, const T& value) { return insert(pos, 1, value); }
+
+  template <typename... Args>
+  constexpr Iterator emplace(size_t pos, Args&&... args) {
+    if (pos > m_size || m_size == N) {
+      throw std::bad_alloc();
+    }
+
+    T item(std::forward<Args>(args)...);
+
+    for (size_t i{m_size}; i > pos; --i) {
+      constructAt(i, std::move(m_data[i - 1]));
+      destroyAt(i - 1);
+    }
+
+    constructAt(pos, std::move(item));
+    ++m_size;
+    return m_data + pos;
+  }
+
+  constexpr reference push_back(const T& item) { return emplace_back(item); }
+  constexpr reference push_back(T&& item) { return emplace_back(std::move(item)); }
+
+  template <typename... Args>
+  constexpr reference emplace_back(Args&&... args) {
+    if (m_size == N) {
+      throw std::bad_alloc();
+    }
+
+    return unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // Returns nullptr instead of throwing when the vector is full.
+  constexpr pointer try_push_back(const T& item) { return try_emplace_back(item); }
+  constexpr pointer try_push_back(T&& item) { return try_emplace_back(std::move(item)); }
+
+  template <typename... Args>
+  constexpr pointer try_emplace_back(Args&&... args) {
+    if (m_size == N) {
+      return nullptr;
+    }
+
+    return &unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // Precondition: size() < capacity()
+  constexpr reference unchecked_push_back(const T& item) { return unchecked_emplace_back(item); }
+  constexpr reference unchecked_push_back(T&& item) {
+    return unchecked_emplace_back(std::move(item));
+  }
+
+  template <typename... Args>
+  constexpr reference unchecked_emplace_back(Args&&... args) {
+    // Local copy: an element store may alias m_size (e.g. T = size_t) and force a reload
+    size_t index = m_size;
+    constructAt(index, std::forward<Args>(args)...);
+    m_size = index + 1;
+    return m_data[index];
+  }
+
+  constexpr void pop_back() noexcept {
+    if (m_size == 0) {
+      return;
+    }
+
+    destroyAt(--m_size);
+  }
+
+  [[nodiscard]] constexpr reference front() noexcept { return m_data[0]; }
+  [[nodiscard]] constexpr const_reference front() const noexcept { return m_data[0]; }
+  [[nodiscard]] constexpr reference back() noexcept { return m_data[m_size - 1]; }
+  [[nodiscard]] constexpr const_reference back() const noexcept { return m_data[m_size - 1]; }
+
+  [[nodiscard]] constexpr reference operator[](size_t index) noexcept { return m_data[index]; };
+  [[nodiscard]] constexpr const_reference operator[](size_t index) const noexcept {
+    return m_data[index];
+  };
+
+  [[nodiscard]] constexpr reference at(size_t index) {
+    if (index >= m_size) {
+      throw std::runtime_error("MySTL::InplaceVector: Index out of bound");
+    }
+
+    return m_data[index];
+  };
+
+  [[nodiscard]] constexpr const_reference at(size_t index) const {
+    if (index >= m_size) {
+      throw std::runtime_error("MySTL::InplaceVector: Index out of bound");
+    }
+
+    return m_data[index];
+  };
+
+  [[nodiscard]] constexpr pointer data() noexcept { return m_data; }
+  [[nodiscard]] constexpr const_pointer data() const noexcept { return m_data; }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+  [[nodiscard]] constexpr bool full() const noexcept { return m_size == N; }
+  [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+  [[nodiscard]] static constexpr size_t max_size() noexcept { return N; }
+  [[nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+  constexpr Iterator begin() noexcept { return m_data; }
+  constexpr Iterator end() noexcept { return m_data + m_size; }
+  constexpr ConstIterator begin() const noexcept { return m_data; }
+  constexpr ConstIterator end() const noexcept { return m_data + m_size; }
+  constexpr ConstIterator cbegin() const noexcept { return m_data; }
+  constexpr ConstIterator cend() const noexcept { return m_data + m_size; }
+
+ private:
+  template <typename... Args>
+  constexpr void constructAt(size_t index, Args&&... args) {
+    // Constant evaluation can only start the lifetime of a union member through assignment
+    if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>) {
+      if (std::is_constant_evaluated()) {
+        m_data[index] = T(std::forward<Args>(args)...);
+        return;
+      }
+    }
+
+    std::construct_at(m_data + index, std::forward<Args>(args)...);
+  }
+
+  constexpr void destroyAt(size_t index) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      std::destroy_at(m_data + index);
+    }
+  }
+
+  // Wrapped in a union so elements are only constructed on demand
+  union {
+    T m_data[N];
+  };
+  size_t m_size{};
+};
+
+}  // namespace MySTL
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "Source/Ranges.hpp"
+#include "Source/Vector.hpp"
+
+namespace MySTL {
+
+namespace Detail {
+
+// Packed blocks hold 128 values split over two 64-bit lanes: even positions in lane 0, odd ones in
+// lane 1, and each lane stores its 64 values back to back. Word k of lane l sits at block[2k + l],
+// so a single 128-bit load brings the same word of both lanes and every value of a block unpacks
+// with one shift count shared by the two lanes (SSE2 has no per-lane variable shift). A block of
+// width w is exactly 2w words; storage keeps two zero words past the last block so a value can
+// always read the word after its own.
+inline constexpr size_t PackedBlockSize = 128;
+
+[[nodiscard]] constexpr uint64_t lowBitsMask(unsigned width) noexcept {
+  return width >= 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+}
+
+[[nodiscard]] inline uint64_t packedGet(const uint64_t* block, unsigned width,
+                                        size_t index) noexcept {
+  size_t bit = (index >> 1) * width;
+  size_t word = 2 * (bit / 64) + (index & 1);
+  unsigned shift = bit % 64;
+
+  // Shifting twice keeps the count below 64 when the value does not cross into the next word
+  uint64_t low = block[word] >> shift;
+  uint64_t high = (block[word + 2] << 1) << (63 - shift);
+  return (low | high) & lowBitsMask(width);
+}
+
+inline void packedSet(uint64_t* block, unsigned width, size_t index, uint64_t value) noexcept {
+  size_t bit = (index >> 1) * width;
+  size_t word = 2 * (bit / 64) + (index & 1);
+  unsigned shift = bit % 64;
+  uint64_t mask = lowBitsMask(width);
+
+  block[word] = (block[word] & ~(mask << shift)) | (value << shift);
+
+  if (shift + width > 64) {
+    unsigned highShift = 64 - shift;
+    block[word + 2] = (block[word + 2] & ~(mask >> highShift)) | (value >> highShift);
+  }
+}
+
+// Unpacks values 2J and 2J + 1 of a block, all offsets are compile time constants
+template <unsigned Width, size_t J>
+inline void unpackPair(const uint64_t* block, uint64_t* out) noexcept {
+  constexpr size_t Bit = J * Width;
+  constexpr size_t Word = 2 * (Bit / 64);
+  constexpr unsigned Shift = Bit % 64;
+
+  if constexpr (Width == 0) {
+    out[2 * J] = 0;
+    out[2 * J + 1] = 0;
+  } else {
+#if defined(__SSE2__)
+    __m128i value =
+        _mm_srli_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + Word)), Shift);
+    if constexpr (Shift + Width > 64) {
+      __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + Word + 2));
+      value = _mm_or_si128(value, _mm_slli_epi64(next, 64 - Shift));
+    }
+    if constexpr (Width < 64) {
+      value = _mm_and_si128(value, _mm_set1_epi64x(static_cast<long long>(lowBitsMask(Width))));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * J), value);
+#else
+    for (size_t lane{}; lane < 2; ++lane) {
+      uint64_t value = block[Word + lane] >> Shift;
+      if constexpr (Shift + Width > 64) {
+        value |= block[Word + lane + 2] << (64 - Shift);
+      }
+      out[2 * J + lane] = value & lowBitsMask(Width);
+    }
+#endif
+  }
+}
+
+template <unsigned Width>
+inline void unpackBlock(const uint64_t* block, uint64_t* out) noexcept {
+  [&]<size_t... J>(std::index_sequence<J...>) {
+    (unpackPair<Width, J>(block, out), ...);
+  }(std::make_index_sequence<PackedBlockSize / 2>{});
+}
+
+using UnpackBlockFunction = void (*)(const uint64_t*, uint64_t*) noexcept;
+
+// Runtime widths dispatch to the fully unrolled unpacker of their width
+inline constexpr std::array<UnpackBlockFunction, 65> UnpackBlockTable =
+    []<unsigned... Width>(std::integer_sequence<unsigned, Width...>) {
+      return std::array<UnpackBlockFunction, 65>{&unpackBlock<Width>...};
+    }(std::make_integer_sequence<unsigned, 65>{});
+
+}  // namespace Detail
+
+// Unsigned integers stored in Width bits each, 64 / Width times denser than Vector<uint64_t>.
+// Width is either fixed at compile time, PackedIntVector<20>, which lets get() fold the masks and
+// shifts, or chosen at runtime with PackedIntVector<>(width) / fromValues().
+//
+// Random access is O(1). decode() unpacks whole blocks of 128 values with SSE2, which is the fast
+// path for sequential scans.
+template <unsigned Width = 0>
+class PackedIntVector {
+  static_assert(Width <= 64, "PackedIntVector width must be at most 64 bits");
+
+ public:
+  using value_type = uint64_t;
+  using size_type = size_t;
+
+  static constexpr size_t BlockSize = Detail::PackedBlockSize;
+
+  struct ConstIterator {
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = uint64_t;
+    using reference = uint64_t;
+
+    ConstIterator() noexcept = default;
+    ConstIterator(const PackedIntVector* vector, size_t index) noexcept
+        : m_vector(vector), m_index(index) {}
+
+    reference operator*() const noexcept { return m_vector->get(m_index); }
+
+    ConstIterator& operator++() noexcept {
+      ++m_index;
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const noexcept { return m_index == other.m_index; }
+
+   private:
+    const PackedIntVector* m_vector{};
+    size_t m_index{};
+  };
+
+  PackedIntVector() noexcept
+    requires(Width != 0)
+  = default;
+
+  explicit PackedIntVector(unsigned width)
+    requires(Width == 0)
+      : m_width(width) {
+    if (width == 0 || width > 64) {
+      throw std::runtime_error("MySTL::PackedIntVector: Bit width must be between 1 and 64");
+    }
+  }
+
+  // Packs values with the smallest width that holds the largest of them
+  template <Range R>
+  [[nodiscard]] static PackedIntVector fromValues(const R& values)
+    requires(Width == 0)
+  {
+    uint64_t maxValue{};
+    size_t count{};
+    for (uint64_t value : values) {
+      maxValue = std::max(maxValue, value);
+      ++count;
+    }
+
+    PackedIntVector result(std::max(1u, static_cast<unsigned>(std::bit_width(maxValue))));
+    result.reserve(count);
+    for (uint64_t value : values) {
+      result.push_back(value);
+    }
+
+    return result;
+  }
+
+  void reserve(size_t count) noexcept {
+    m_words.reserve((count + BlockSize - 1) / BlockSize * wordsPerBlock() + 2);
+  }
+
+  void push_back(uint64_t value) {
+    if (value > Detail::lowBitsMask(bitWidth())) {
+      throw std::runtime_error("MySTL::PackedIntVector: Value does not fit in bit width");
+    }
+
+    if (m_size % BlockSize == 0) {
+      // The two trailing zero words become the start of the new block
+      for (size_t i = m_words.empty() ? 0 : 2; i < wordsPerBlock() + 2; ++i) {
+        m_words.push_back(0);
+      }
+    }
+
+    Detail::packedSet(block(m_size / BlockSize), bitWidth(), m_size % BlockSize, value);
+    ++m_size;
+  }
+
+  void pop_back() noexcept {
+    if (m_size == 0) {
+      return;
+    }
+
+    --m_size;
+    Detail::packedSet(block(m_size / BlockSize), bitWidth(), m_size % BlockSize, 0);
+
+    if (m_size % BlockSize == 0) {
+      for (size_t i{}; i < wordsPerBlock(); ++i) {
+        m_words.pop_back();
+      }
+    }
+  }
+
+  void set(size_t index, uint64_t value) {
+    if (value > Detail::lowBitsMask(bitWidth())) {
+      throw std::runtime_error("MySTL::PackedIntVector: Value does not fit in bit width");
+    }
+
+    Detail::packedSet(block(index / BlockSize), bitWidth(), index % BlockSize, value);
+  }
+
+  [[nodiscard]] uint64_t get(size_t index) const noexcept {
+    return Detail::packedGet(block(index / BlockSize), bitWidth(), index % BlockSize);
+  }
+
+  [[nodiscard]] uint64_t operator[](size_t index) const noexcept { return get(index); }
+
+  [[nodiscard]] uint64_t at(size_t index) const {
+    if (index >= m_size) {
+      throw std::runtime_error("MySTL::PackedIntVector: Index out of bound");
+    }
+
+    return get(index);
+  }
+
+  // Writes values [first, first + count) to out, whole blocks at a time where aligned
+  void decode(size_t first, size_t count, uint64_t* out) const noexcept {
+    size_t index = first;
+    size_t last = first + count;
+
+    for (; index < last && index % BlockSize != 0; ++index) {
+      *out++ = get(index);
+    }
+
+    for (; last - index >= BlockSize; index += BlockSize, out += BlockSize) {
+      if constexpr (Width != 0) {
+        Detail::unpackBlock<Width>(block(index / BlockSize), out);
+      } else {
+        Detail::UnpackBlockTable[m_width](block(index / BlockSize), out);
+      }
+    }
+
+    for (; index < last; ++index) {
+      *out++ = get(index);
+    }
+  }
+
+  void clear() noexcept {
+    m_words.clear();
+    m_size = 0;
+  }
+
+  [[nodiscard]] constexpr unsigned bitWidth() const noexcept {
+    if constexpr (Width != 0) {
+      return Width;
+    } else {
+      return m_width;
+    }
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+  [[nodiscard]] size_t size() const noexcept { return m_size; }
+  [[nodiscard]] size_t num_words() const noexcept { return m_words.size(); }
+
+  ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+  ConstIterator end() const noexcept { return ConstIterator(this, m_size); }
+
+ private:
+  [[nodiscard]] size_t wordsPerBlock() const noexcept { return 2 * size_t{bitWidth()}; }
+
+  [[nodiscard]] const uint64_t* block(size_t index) const noexcept {
+    return &m_words[index * wordsPerBlock()];
+  }
+  [[nodiscard]] uint64_t* block(size_t index) noexcept { return &m_words[index * wordsPerBlock()]; }
+
+  Vector<uint64_t> m_words;
+  size_t m_size{};
+  unsigned m_width{Width};
+};
+
+}  // namespace MySTL
@@ -0,0 +1,443 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "Source/InplaceVector.hpp"
+
+namespace MySTL {
+
+// Immutable vector backed by a 32-way trie with structural sharing. Copies (snapshots) are O(1),
+// set/push_back/pop_back return a new version in O(log32 n) and share every untouched node with
+// the original. The last partial leaf is kept outside the trie (tail) so push_back is amortized
+// O(1). Nodes are reference counted with std::shared_ptr, so versions can be handed to any thread.
+//
+// Batches of edits go through a Transient, which owns the nodes it has already copied and updates
+// them in place instead of copying the path again on every call.
+template <typename T>
+class PersistentVector {
+  static constexpr size_t Bits = 5;
+  static constexpr size_t Width = size_t{1} << Bits;
+  static constexpr size_t Mask = Width - 1;
+
+  struct Node {
+    // Id of the Transient allowed to modify this node in place, 0 when shared.
+    uint64_t edit{};
+  };
+
+  struct Internal : Node {
+    InplaceVector<std::shared_ptr<Node>, Width> children;
+  };
+
+  struct Leaf : Node {
+    InplaceVector<T, Width> values;
+  };
+
+  using NodePtr = std::shared_ptr<Node>;
+  using LeafPtr = std::shared_ptr<Leaf>;
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using const_reference = const value_type&;
+
+  class Transient;
+
+  struct ConstIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+
+    ConstIterator() noexcept = default;
+    ConstIterator(const PersistentVector* vector, size_t index) noexcept
+        : m_vector(vector), m_index(index) {}
+
+    reference operator*() const { return leaf()[m_index & Mask]; }
+    pointer operator->() const { return &leaf()[m_index & Mask]; }
+
+    ConstIterator& operator++() {
+      if ((++m_index & Mask) == 0) {
+        m_leaf = nullptr;
+      }
+
+      return *this;
+    }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const { return m_index == other.m_index; }
+    bool operator!=(const ConstIterator& other) const { return m_index != other.m_index; }
+
+   private:
+    // Walks the trie once per 32 elements
+    const T* leaf() const {
+      if (!m_leaf) {
+        m_leaf = m_vector->leafFor(m_index).data();
+      }
+
+      return m_leaf;
+    }
+
+    const PersistentVector* m_vector{nullptr};
+    size_t m_index{};
+    mutable const T* m_leaf{nullptr};
+  };
+
+  PersistentVector() : m_root(std::make_shared<Internal>()), m_tail(std::make_shared<Leaf>()) {}
+
+  explicit PersistentVector(size_t count, const T& item) : PersistentVector() {
+    Transient transient(*this);
+
+    for (size_t i{}; i < count; ++i) {
+      transient.push_back(item);
+    }
+
+    *this = transient.persistent();
+  }
+
+  PersistentVector(std::initializer_list<T> items) : PersistentVector() {
+    Transient transient(*this);
+
+    for (auto&& item : items) {
+      transient.push_back(item);
+    }
+
+    *this = transient.persistent();
+  }
+
+  [[nodiscard]] PersistentVector set(size_t index, T value) const {
+    PersistentVector result(*this);
+    result.assign(index, std::move(value), 0);
+    return result;
+  }
+
+  [[nodiscard]] PersistentVector push_back(T value) const {
+    PersistentVector result(*this);
+    result.append(std::move(value), 0);
+    return result;
+  }
+
+  [[nodiscard]] PersistentVector pop_back() const {
+    PersistentVector result(*this);
+    result.removeLast(0);
+    return result;
+  }
+
+  [[nodiscard]] Transient transient() const { return Transient(*this); }
+
+  [[nodiscard]] const_reference operator[](size_t index) const noexcept {
+    return leafFor(index)[index & Mask];
+  }
+
+  [[nodiscard]] const_reference at(size_t index) const {
+    if (index >= m_size) {
+      throw std::runtime_error("MySTL::PersistentVector: Index out of bound");
+    }
+
+    return (*this)[index];
+  }
+
+  [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+  [[nodiscard]] const_reference back() const noexcept { return m_tail->values.back(); }
+
+  [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+  [[nodiscard]] size_t size() const noexcept { return m_size; }
+
+  ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+  ConstIterator end() const noexcept { return ConstIterator(this, m_size); }
+  ConstIterator cbegin() const noexcept { return begin(); }
+  ConstIterator cend() const noexcept { return end(); }
+
+ private:
+  static uint64_t nextEdit() noexcept {
+    static std::atomic<uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // Node that may be modified by edit: the node itself if the Transient already owns it, otherwise
+  // a copy. edit == 0 (persistent operations) always copies.
+  template <typename NodeType>
+  static std::shared_ptr<NodeType> editable(const NodePtr& node, uint64_t edit) {
+    if (edit != 0 && node->edit == edit) {
+      return std::static_pointer_cast<NodeType>(node);
+    }
+
+    auto copy = std::make_shared<NodeType>(*static_cast<const NodeType*>(node.get()));
+    copy->edit = edit;
+    return copy;
+  }
+
+  static NodePtr newPath(size_t level, NodePtr node, uint64_t edit) {
+    if (level == 0) {
+      return node;
+    }
+
+    auto parent = std::make_shared<Internal>();
+    parent->edit = edit;
+    parent->children.push_back(newPath(level - Bits, std::move(node), edit));
+    return parent;
+  }
+
+  [[nodiscard]] size_t tailOffset() const noexcept {
+    return m_size < Width ? 0 : ((m_size - 1) >> Bits) << Bits;
+  }
+
+  [[nodiscard]] const InplaceVector<T, Width>& leafFor(size_t index) const noexcept {
+    if (index >= tailOffset()) {
+      return m_tail->values;
+    }
+
+    return static_cast<const Leaf*>(findLeaf(index).get())->values;
+  }
+
+  // Leaf of the trie holding index, which must be below tailOffset().
+  [[nodiscard]] const NodePtr& findLeaf(size_t index) const noexcept {
+    const NodePtr* node = &m_root;
+    for (size_t level{m_shift}; level > 0; level -= Bits) {
+      node = &static_cast<const Internal*>(node->get())->children[(index >> level) & Mask];
+    }
+
+    return *node;
+  }
+
+  void assign(size_t index, T value, uint64_t edit) {
+    if (index >= m_size) {
+      throw std::runtime_error("MySTL::PersistentVector: Index out of bound");
+    }
+
+    if (index >= tailOffset()) {
+      m_tail = editable<Leaf>(m_tail, edit);
+      m_tail->values[index & Mask] = std::move(value);
+      return;
+    }
+
+    m_root = assignIn(m_shift, m_root, index, std::move(value), edit);
+  }
+
+  static NodePtr assignIn(size_t level, const NodePtr& node, size_t index, T&& value,
+                          uint64_t edit) {
+    if (level == 0) {
+      auto leaf = editable<Leaf>(node, edit);
+      leaf->values[index & Mask] = std::move(value);
+      return leaf;
+    }
+
+    auto parent = editable<Internal>(node, edit);
+    size_t slot = (index >> level) & Mask;
+    parent->children[slot] =
+        assignIn(level - Bits, parent->children[slot], index, std::move(value), edit);
+    return parent;
+  }
+
+  void append(T value, uint64_t edit) {
+    if (m_size - tailOffset() < Width) {
+      m_tail = editable<Leaf>(m_tail, edit);
+      m_tail->values.push_back(std::move(value));
+      ++m_size;
+      return;
+    }
+
+    // Tail is full, move it into the trie and start a new one
+    NodePtr fullTail = std::move(m_tail);
+
+    if ((m_size >> Bits) > (size_t{1} << m_shift)) {
+      auto root = std::make_shared<Internal>();
+      root->edit = edit;
+      root->children.push_back(m_root);
+      root->children.push_back(newPath(m_shift, std::move(fullTail), edit));
+      m_root = std::move(root);
+      m_shift += Bits;
+    } else {
+      m_root = pushTail(m_shift, m_root, std::move(fullTail), edit);
+    }
+
+    m_tail = std::make_shared<Leaf>();
+    m_tail->edit = edit;
+    m_tail->values.push_back(std::move(value));
+    ++m_size;
+  }
+
+  NodePtr pushTail(size_t level, const NodePtr& node, NodePtr tail, uint64_t edit) const {
+    auto parent = editable<Internal>(node, edit);
+    size_t slot = ((m_size - 1) >> level) & Mask;
+
+    NodePtr child;
+    if (level == Bits) {
+      child = std::move(tail);
+    } else if (slot < parent->children.size()) {
+      child = pushTail(level - Bits, parent->children[slot], std::move(tail), edit);
+    } else {
+      child = newPath(level - Bits, std::move(tail), edit);
+    }
+
+    if (slot < parent->children.size()) {
+      parent->children[slot] = std::move(child);
+    } else {
+      parent->children.push_back(std::move(child));
+    }
+
+    return parent;
+  }
+
+  void removeLast(uint64_t edit) {
+    if (m_size == 0) {
+      return;
+    }
+
+    if (m_size == 1) {
+      *this = PersistentVector();
+      return;
+    }
+
+    if (m_size - tailOffset() > 1) {
+      m_tail = editable<Leaf>(m_tail, edit);
+      m_tail->values.pop_back();
+      --m_size;
+      return;
+    }
+
+    // Tail becomes empty, the last leaf of the trie is the new tail
+    m_tail = std::static_pointer_cast<Leaf>(findLeaf(m_size - 2));
+
+    NodePtr root = popTail(m_shift, m_root, edit);
+    if (!root) {
+      auto empty = std::make_shared<Internal>();
+      empty->edit = edit;
+      root = std::move(empty);
+    }
+
+    if (m_shift > Bits && static_cast<Internal*>(root.get())->children.size() == 1) {
+      root = static_cast<Internal*>(root.get())->children[0];
+      m_shift -= Bits;
+    }
+
+    m_root = std::move(root);
+    --m_size;
+  }
+
+  NodePtr popTail(size_t level, const NodePtr& node, uint64_t edit) const {
+    size_t slot = ((m_size - 2) >> level) & Mask;
+    const auto* internal = static_cast<const Internal*>(node.get());
+
+    if (level > Bits) {
+      NodePtr child = popTail(level - Bits, internal->children[slot], edit);
+      if (!child && slot == 0) {
+        return nullptr;
+      }
+
+      auto parent = editable<Internal>(node, edit);
+      if (child) {
+        parent->children[slot] = std::move(child);
+      } else {
+        parent->children.pop_back();
+      }
+
+      return parent;
+    }
+
+    if (slot == 0) {
+      return nullptr;
+    }
+
+    auto parent = editable<Internal>(node, edit);
+    parent->children.pop_back();
+    return parent;
+  }
+
+  size_t m_size{};
+  size_t m_shift{Bits};
+  NodePtr m_root;
+  LeafPtr m_tail;
+};
+
+template <typename T>
+class PersistentVector<T>::Transient {
+ public:
+  explicit Transient(PersistentVector vector) : m_vector(std::move(vector)), m_edit(nextEdit()) {}
+
+  // A copy would share the edit token and change the nodes of the original in place, including
+  // those of versions already frozen by persistent()
+  Transient(const Transient&) = delete;
+  Transient& operator=(const Transient&) = delete;
+  Transient(Transient&&) noexcept = default;
+  Transient& operator=(Transient&&) noexcept = default;
+
+  Transient& set(size_t index, T value) {
+    m_vector.assign(index, std::move(value), m_edit);
+    return *this;
+  }
+
+  Transient& push_back(T value) {
+    m_vector.append(std::move(value), m_edit);
+    return *this;
+  }
+
+  Transient& pop_back() {
+    m_vector.removeLast(m_edit);
+    return *this;
+  }
+
+  [[nodiscard]] const_reference operator[](size_t index) const noexcept { return m_vector[index]; }
+  [[nodiscard]] size_t size() const noexcept { return m_vector.size(); }
+  [[nodiscard]] bool empty() const noexcept { return m_vector.empty(); }
+
+  // Freezes the current content. The nodes become shared, so later edits through this Transient
+  // copy them again instead of changing the returned version.
+  [[nodiscard]] PersistentVector persistent() {
+    m_edit = nextEdit();
+    return m_vector;
+  }
+
+ private:
+  PersistentVector m_vector;
+  uint64_t m_edit;
+};
+
+// Publishes one PersistentVector version to many readers. Readers take a snapshot with load() and
+// keep reading it while writers publish new versions, no reader ever sees a partial update.
+template <typename T>
+class AtomicPersistentVector {
+ public:
+  using Snapshot = std::shared_ptr<const PersistentVector<T>>;
+
+  explicit AtomicPersistentVector(PersistentVector<T> initial = {})
+      : m_current(std::make_shared<const PersistentVector<T>>(std::move(initial))) {}
+
+  [[nodiscard]] Snapshot load() const noexcept { return m_current.load(std::memory_order_acquire); }
+
+  void store(PersistentVector<T> vector) {
+    m_current.store(std::make_shared<const PersistentVector<T>>(std::move(vector)),
+                    std::memory_order_release);
+  }
+
+  // Applies function to the latest version and publishes the result, retrying when another writer
+  // published in between. function must not have side effects, it may run more than once.
+  template <typename Function>
+  PersistentVector<T> update(Function&& function) {
+    Snapshot current = load();
+
+    while (true) {
+      auto next = std::make_shared<const PersistentVector<T>>(function(*current));
+      if (m_current.compare_exchange_weak(current, next, std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+        return *next;
+      }
+    }
+  }
+
+ private:
+  std::atomic<Snapshot> m_current;
+};
+
+}  // namespace MySTL
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "Source/Ranges.hpp"
+#include "Source/SlotMap.hpp"
+#include "Source/Vector.hpp"
+
+namespace MySTL {
+
+namespace Detail {
+
+// Sift helpers shared by the d-ary heaps. Both carry the moving value in a hole instead of swapping
+// at every level, and report every element that lands on a new position to onPlace.
+template <size_t Arity, typename T, typename Compare, typename OnPlace>
+void heapSiftUp(T* heap, size_t index, T value, Compare& compare, OnPlace onPlace) {
+  while (index > 0) {
+    size_t parent = (index - 1) / Arity;
+    if (!compare(heap[parent], value)) {
+      break;
+    }
+
+    heap[index] = std::move(heap[parent]);
+    onPlace(heap[index], index);
+    index = parent;
+  }
+
+  heap[index] = std::move(value);
+  onPlace(heap[index], index);
+}
+
+// The children of a node are adjacent, with Arity 4 and 8 byte elements they share a cache line.
+// Full groups take a loop with a constant trip count the compiler unrolls into conditional moves.
+template <size_t Arity, typename T, typename Compare>
+size_t heapBestChild(const T* heap, size_t first, size_t size, Compare& compare) {
+  size_t best = first;
+
+  if constexpr (Arity == 4) {
+    // Pairwise tournament, two independent comparisons before the final one
+    if (first + Arity <= size) {
+      size_t left = compare(heap[first], heap[first + 1]) ? first + 1 : first;
+      size_t right = compare(heap[first + 2], heap[first + 3]) ? first + 3 : first + 2;
+      return compare(heap[left], heap[right]) ? right : left;
+    }
+  }
+
+  if (first + Arity <= size) {
+    for (size_t child{first + 1}; child < first + Arity; ++child) {
+      best = compare(heap[best], heap[child]) ? child : best;
+    }
+  } else {
+    for (size_t child{first + 1}; child < size; ++child) {
+      best = compare(heap[best], heap[child]) ? child : best;
+    }
+  }
+
+  return best;
+}
+
+template <size_t Arity, typename T, typename Compare, typename OnPlace>
+void heapSiftDown(T* heap, size_t size, size_t index, T value, Compare& compare, OnPlace onPlace) {
+  while (true) {
+    size_t first = index * Arity + 1;
+    if (first >= size) {
+      break;
+    }
+
+    size_t best = heapBestChild<Arity>(heap, first, size, compare);
+    if (!compare(value, heap[best])) {
+      break;
+    }
+
+    heap[index] = std::move(heap[best]);
+    onPlace(heap[index], index);
+    index = best;
+  }
+
+  heap[index] = std::move(value);
+  onPlace(heap[index], index);
+}
+
+// Refills the root hole after a pop. The replacement comes from the bottom and usually belongs
+// there, so the hole is walked down to a leaf without comparing against it and the value then
+// sifts up the few levels it needs (Floyd), saving a comparison per level.
+template <size_t Arity, typename T, typename Compare, typename OnPlace>
+void heapReplaceTop(T* heap, size_t size, T value, Compare& compare, OnPlace onPlace) {
+  size_t index = 0;
+
+  while (true) {
+    size_t first = index * Arity + 1;
+    if (first >= size) {
+      break;
+    }
+
+    size_t best = heapBestChild<Arity>(heap, first, size, compare);
+    heap[index] = std::move(heap[best]);
+    onPlace(heap[index], index);
+    index = best;
+  }
+
+  heapSiftUp<Arity>(heap, index, std::move(value), compare, onPlace);
+}
+
+}  // namespace Detail
+
+// Max-heap under Compare like std::priority_queue (pass std::greater for a min-heap), but with
+// Arity children per node. A wider node halves the depth of the tree compared to a binary heap, so
+// pop touches fewer cache lines on large heaps at the price of more comparisons per level.
+//
+// push_range appends a batch and rebuilds the heap bottom-up in O(n) when the batch is large
+// compared to the heap, otherwise sifts the new elements up one by one.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue {
+  static_assert(Arity >= 2, "PriorityQueue needs at least two children per node");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using value_compare = Compare;
+
+  explicit PriorityQueue(const Compare& compare = Compare()) : m_compare(compare) {}
+
+  void reserve(size_t capacity) noexcept { m_heap.reserve(capacity); }
+
+  void push(const T& item) { emplace(item); }
+  void push(T&& item) { emplace(std::move(item)); }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    m_heap.emplace_back(std::forward<Args>(args)...);
+
+    T value = std::move(m_heap.back());
+    Detail::heapSiftUp<Arity>(&m_heap[0], m_heap.size() - 1, std::move(value), m_compare,
+                              NoPlace{});
+  }
+
+  template <Range R>
+  void push_range(R&& range) {
+    size_t oldSize = m_heap.size();
+
+    if constexpr (SizedRange<std::remove_reference_t<R>>) {
+      m_heap.reserve(oldSize + range.size());
+    }
+    for (auto&& item : range) {
+      m_heap.emplace_back(std::forward<decltype(item)>(item));
+    }
+
+    size_t added = m_heap.size() - oldSize;
+    if (added > oldSize / 2) {
+      heapify();
+      return;
+    }
+
+    for (size_t i{oldSize}; i < m_heap.size(); ++i) {
+      T value = std::move(m_heap[i]);
+      Detail::heapSiftUp<Arity>(&m_heap[0], i, std::move(value), m_compare, NoPlace{});
+    }
+  }
+
+  // Precondition: !empty()
+  void pop() {
+    T value = std::move(m_heap.back());
+    m_heap.pop_back();
+
+    if (!m_heap.empty()) {
+      Detail::heapReplaceTop<Arity>(&m_heap[0], m_heap.size(), std::move(value), m_compare,
+                                    NoPlace{});
+    }
+  }
+
+  [[nodiscard]] const_reference top() const noexcept { return m_heap[0]; }
+
+  void clear() noexcept { m_heap.clear(); }
+
+  [[nodiscard]] bool empty() const noexcept { return m_heap.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return m_heap.size(); }
+
+ private:
+  struct NoPlace {
+    void operator()(const T&, size_t) const noexcept {}
+  };
+
+  void heapify() {
+    if (m_heap.size() < 2) {
+      return;
+    }
+
+    for (size_t i = (m_heap.size() - 2) / Arity + 1; i-- > 0;) {
+      T value = std::move(m_heap[i]);
+      Detail::heapSiftDown<Arity>(&m_heap[0], m_heap.size(), i, std::move(value), m_compare,
+                                  NoPlace{});
+    }
+  }
+
+  Vector<T> m_heap;
+  [[no_unique_address]] Compare m_compare;
+};
+
+// d-ary heap whose elements stay addressable through handles, for priorities that change while
+// queued (timers being rescheduled, Dijkstra distances). Handles are SlotHandles: a slot table maps
+// them to the current heap position and the generation detects handles to popped elements.
+//
+// update, decrease_key and erase are O(log n). decrease_key follows the graph algorithm naming and
+// assumes the new value moves the element towards the top (a smaller distance with std::greater).
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "IndexedPriorityQueue needs at least two children per node");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using const_reference = const value_type&;
+  using value_compare = Compare;
+  using Handle = SlotHandle;
+
+  explicit IndexedPriorityQueue(const Compare& compare = Compare()) : m_compare{compare} {}
+
+  void reserve(size_t capacity) noexcept {
+    m_heap.reserve(capacity);
+    m_slots.reserve(capacity);
+  }
+
+  Handle push(const T& item) { return emplace(item); }
+  Handle push(T&& item) { return emplace(std::move(item)); }
+
+  template <typename... Args>
+  Handle emplace(Args&&... args) {
+    uint32_t slotIndex;
+
+    if (m_freeHead != SlotHandle::InvalidIndex) {
+      slotIndex = m_freeHead;
+      m_freeHead = m_slots[slotIndex].position;
+    } else {
+      if (m_slots.size() >= SlotHandle::InvalidIndex) {
+        throw std::runtime_error("MySTL::IndexedPriorityQueue: Too many slots");
+      }
+
+      slotIndex = static_cast<uint32_t>(m_slots.size());
+      m_slots.push_back(Slot{});
+    }
+
+    m_heap.push_back(Entry{T(std::forward<Args>(args)...), slotIndex});
+
+    Entry entry = std::move(m_heap.back());
+    Detail::heapSiftUp<Arity>(&m_heap[0], m_heap.size() - 1, std::move(entry), m_compare,
+                              PlaceEntry{this});
+
+    return Handle{slotIndex, m_slots[slotIndex].generation};
+  }
+
+  // Precondition: !empty()
+  void pop() { removeAt(0); }
+
+  [[nodiscard]] const_reference top() const noexcept { return m_heap[0].value; }
+  [[nodiscard]] Handle top_handle() const noexcept {
+    return Handle{m_heap[0].slot, m_slots[m_heap[0].slot].generation};
+  }
+
+  // Replaces the value and restores the heap in whichever direction it moved. Returns false when
+  // the handle was already stale.
+  bool update(Handle handle, T value) {
+    if (!contains(handle)) {
+      return false;
+    }
+
+    size_t position = m_slots[handle.index].position;
+    bool towardsTop = m_compare.compare(m_heap[position].value, value);
+    Entry entry{std::move(value), handle.index};
+
+    if (towardsTop) {
+      Detail::heapSiftUp<Arity>(&m_heap[0], position, std::move(entry), m_compare,
+                                PlaceEntry{this});
+    } else {
+      Detail::heapSiftDown<Arity>(&m_heap[0], m_heap.size(), position, std::move(entry), m_compare,
+                                  PlaceEntry{this});
+    }
+
+    return true;
+  }
+
+  // Precondition: value does not rank below the current one. Returns false for a stale handle.
+  bool decrease_key(Handle handle, T value) {
+    if (!contains(handle)) {
+      return false;
+    }
+
+    Entry entry{std::move(value), handle.index};
+    Detail::heapSiftUp<Arity>(&m_heap[0], m_slots[handle.index].position, std::move(entry),
+                              m_compare, PlaceEntry{this});
+    return true;
+  }
+
+  // Returns false when the handle was already stale.
+  bool erase(Handle handle) {
+    if (!contains(handle)) {
+      return false;
+    }
+
+    removeAt(m_slots[handle.index].position);
+    return true;
+  }
+
+  [[nodiscard]] bool contains(Handle handle) const noexcept {
+    return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation &&
+           m_slots[handle.index].position < m_heap.size() &&
+           m_heap[m_slots[handle.index].position].slot == handle.index;
+  }
+
+  // Precondition: contains(handle)
+  [[nodiscard]] const_reference operator[](Handle handle) const noexcept {
+    return m_heap[m_slots[handle.index].position].value;
+  }
+
+  [[nodiscard]] const_reference at(Handle handle) const {
+    if (!contains(handle)) {
+      throw std::runtime_error("MySTL::IndexedPriorityQueue: Stale handle");
+    }
+
+    return (*this)[handle];
+  }
+
+  void clear() noexcept {
+    while (!empty()) {
+      removeAt(m_heap.size() - 1);
+    }
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return m_heap.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return m_heap.size(); }
+
+ private:
+  struct Entry {
+    T value;
+    uint32_t slot;
+  };
+
+  struct Slot {
+    // Heap position while queued, next free slot while free
+    uint32_t position{SlotHandle::InvalidIndex};
+    uint32_t generation{};
+  };
+
+  struct EntryCompare {
+    bool operator()(const Entry& a, const Entry& b) const { return compare(a.value, b.value); }
+
+    [[no_unique_address]] Compare compare;
+  };
+
+  struct PlaceEntry {
+    void operator()(const Entry& entry, size_t position) const noexcept {
+      queue->m_slots[entry.slot].position = static_cast<uint32_t>(position);
+    }
+
+    IndexedPriorityQueue* queue;
+  };
+
+  void removeAt(size_t position) {
+    uint32_t slotIndex = m_heap[position].slot;
+    Entry last = std::move(m_heap.back());
+    m_heap.pop_back();
+
+    if (position < m_heap.size()) {
+      // The last entry may belong above or below the hole it fills
+      if (position == 0) {
+        Detail::heapReplaceTop<Arity>(&m_heap[0], m_heap.size(), std::move(last), m_compare,
+                                      PlaceEntry{this});
+      } else if (m_compare(m_heap[(position - 1) / Arity], last)) {
+        Detail::heapSiftUp<Arity>(&m_heap[0], position, std::move(last), m_compare,
+                                  PlaceEntry{this});
+      } else {
+        Detail::heapSiftDown<Arity>(&m_heap[0], m_heap.size(), position, std::move(last),
+                                    m_compare, PlaceEntry{this});
+      }
+    }
+
+    // A slot whose generation wraps around is retired, old handles could otherwise match again
+    Slot& slot = m_slots[slotIndex];
+    if (++slot.generation != 0) {
+      slot.position = m_freeHead;
+      m_freeHead = slotIndex;
+    } else {
+      slot.position = SlotHandle::InvalidIndex;
+    }
+  }
+
+  Vector<Entry> m_heap;
+  Vector<Slot> m_slots;
+  uint32_t m_freeHead{SlotHandle::InvalidIndex};
+  [[no_unique_address]] EntryCompare m_compare;
+};
+
+}  // namespace MySTL
@@ -0,0 +1,616 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace MySTL {
+
+template <typename R>
+concept Range = requires(R& range) {
+  range.begin();
+  range.end();
+};
+
+template <typename R>
+concept SizedRange = Range<R> && requires(R& range) {
+  { range.size() } -> std::convertible_to<size_t>;
+};
+
+template <Range R>
+using RangeIterator = decltype(std::declval<R&>().begin());
+
+template <Range R>
+using RangeSentinel = decltype(std::declval<R&>().end());
+
+template <Range R>
+using RangeReference = decltype(*std::declval<RangeIterator<R>&>());
+
+template <Range R>
+using RangeValue = std::iter_value_t<RangeIterator<R>>;
+
+// Lazy views over any Range (MySTL::Vector, std containers, other views). Adaptors are chained
+// with operator| and nothing is evaluated until the pipeline is iterated: every element flows
+// through the whole chain before the next one is read, so a filter | transform | take pipeline is a
+// single pass with no intermediate container.
+//
+// Views reference lvalue ranges and take ownership of rvalue ones. Iterators point back into their
+// view, so a view must outlive them (as in a range-for over the pipeline expression).
+namespace Views {
+
+// Marks cheap to copy ranges that adaptors store by value
+struct ViewBase {};
+
+template <typename R>
+concept View = Range<R> && std::derived_from<R, ViewBase>;
+
+template <Range R>
+class RefView : public ViewBase {
+ public:
+  constexpr explicit RefView(R& range) noexcept : m_range(&range) {}
+
+  [[nodiscard]] constexpr auto begin() const { return m_range->begin(); }
+  [[nodiscard]] constexpr auto end() const { return m_range->end(); }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<R>
+  {
+    return m_range->size();
+  }
+
+ private:
+  R* m_range;
+};
+
+template <Range R>
+class OwningView : public ViewBase {
+ public:
+  constexpr explicit OwningView(R&& range) : m_range(std::move(range)) {}
+
+  [[nodiscard]] constexpr auto begin() const { return m_range.begin(); }
+  [[nodiscard]] constexpr auto end() const { return m_range.end(); }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<const R>
+  {
+    return m_range.size();
+  }
+
+ private:
+  R m_range;
+};
+
+template <Range R>
+[[nodiscard]] constexpr auto all(R&& range) {
+  if constexpr (View<std::remove_cvref_t<R>>) {
+    return std::remove_cvref_t<R>(std::forward<R>(range));
+  } else if constexpr (std::is_lvalue_reference_v<R>) {
+    return RefView<std::remove_reference_t<R>>(range);
+  } else {
+    return OwningView<std::remove_cvref_t<R>>(std::move(range));
+  }
+}
+
+template <Range R>
+using All = decltype(all(std::declval<R>()));
+
+// Pair of iterators, the element type of chunk
+template <std::input_or_output_iterator It>
+class Subrange : public ViewBase {
+ public:
+  constexpr Subrange() = default;
+  constexpr Subrange(It first, It last) : m_begin(first), m_end(last) {}
+
+  [[nodiscard]] constexpr It begin() const { return m_begin; }
+  [[nodiscard]] constexpr It end() const { return m_end; }
+  [[nodiscard]] constexpr bool empty() const { return m_begin == m_end; }
+  [[nodiscard]] constexpr size_t size() const
+    requires std::sized_sentinel_for<It, It>
+  {
+    return static_cast<size_t>(m_end - m_begin);
+  }
+
+ private:
+  It m_begin{};
+  It m_end{};
+};
+
+// The predicate runs once per element while advancing and the element is read again on
+// dereference, so expensive transforms should come after the filter.
+template <View Base, typename Pred>
+class FilterView : public ViewBase {
+  using BaseIterator = RangeIterator<const Base>;
+  using BaseSentinel = RangeSentinel<const Base>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = RangeValue<const Base>;
+    using reference = RangeReference<const Base>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(BaseIterator current, BaseSentinel end, const Pred* pred)
+        : m_current(std::move(current)), m_end(std::move(end)), m_pred(pred) {
+      skipRejected();
+    }
+
+    constexpr reference operator*() const { return *m_current; }
+
+    constexpr Iterator& operator++() {
+      ++m_current;
+      skipRejected();
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+    constexpr bool operator==(std::default_sentinel_t) const { return m_current == m_end; }
+
+   private:
+    constexpr void skipRejected() {
+      while (m_current != m_end && !std::invoke(*m_pred, *m_current)) {
+        ++m_current;
+      }
+    }
+
+    BaseIterator m_current{};
+    [[no_unique_address]] BaseSentinel m_end{};
+    const Pred* m_pred{};
+  };
+
+  constexpr FilterView(Base base, Pred pred) : m_base(std::move(base)), m_pred(std::move(pred)) {}
+
+  [[nodiscard]] constexpr Iterator begin() const {
+    return Iterator(m_base.begin(), m_base.end(), &m_pred);
+  }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+
+ private:
+  Base m_base;
+  Pred m_pred;
+};
+
+template <View Base, typename Fn>
+class TransformView : public ViewBase {
+  using BaseIterator = RangeIterator<const Base>;
+  using BaseSentinel = RangeSentinel<const Base>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::invoke_result_t<const Fn&, RangeReference<const Base>>;
+    using value_type = std::remove_cvref_t<reference>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(BaseIterator current, BaseSentinel end, const Fn* fn)
+        : m_current(std::move(current)), m_end(std::move(end)), m_fn(fn) {}
+
+    constexpr reference operator*() const { return std::invoke(*m_fn, *m_current); }
+
+    constexpr Iterator& operator++() {
+      ++m_current;
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+    constexpr bool operator==(std::default_sentinel_t) const { return m_current == m_end; }
+
+   private:
+    BaseIterator m_current{};
+    [[no_unique_address]] BaseSentinel m_end{};
+    const Fn* m_fn{};
+  };
+
+  constexpr TransformView(Base base, Fn fn) : m_base(std::move(base)), m_fn(std::move(fn)) {}
+
+  [[nodiscard]] constexpr Iterator begin() const {
+    return Iterator(m_base.begin(), m_base.end(), &m_fn);
+  }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<const Base>
+  {
+    return m_base.size();
+  }
+
+ private:
+  Base m_base;
+  Fn m_fn;
+};
+
+template <View Base>
+class TakeView : public ViewBase {
+  using BaseIterator = RangeIterator<const Base>;
+  using BaseSentinel = RangeSentinel<const Base>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = RangeValue<const Base>;
+    using reference = RangeReference<const Base>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(BaseIterator current, BaseSentinel end, size_t remaining)
+        : m_current(std::move(current)), m_end(std::move(end)), m_remaining(remaining) {}
+
+    constexpr reference operator*() const { return *m_current; }
+
+    // The base is not advanced past the last taken element, which could be costly (a filter
+    // scanning ahead) or invalid (an input source)
+    constexpr Iterator& operator++() {
+      if (--m_remaining != 0) {
+        ++m_current;
+      }
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    // Iterators of one view at the same position have the same remaining count
+    constexpr bool operator==(const Iterator& other) const {
+      return m_remaining == other.m_remaining;
+    }
+    constexpr bool operator==(std::default_sentinel_t) const {
+      return m_remaining == 0 || m_current == m_end;
+    }
+
+   private:
+    BaseIterator m_current{};
+    [[no_unique_address]] BaseSentinel m_end{};
+    size_t m_remaining{};
+  };
+
+  constexpr TakeView(Base base, size_t count) : m_base(std::move(base)), m_count(count) {}
+
+  [[nodiscard]] constexpr Iterator begin() const {
+    return Iterator(m_base.begin(), m_base.end(), m_count);
+  }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<const Base>
+  {
+    return std::min(m_count, static_cast<size_t>(m_base.size()));
+  }
+
+ private:
+  Base m_base;
+  size_t m_count;
+};
+
+// Splits the range into Subranges of count elements, the last one holding the remainder
+template <View Base>
+class ChunkView : public ViewBase {
+  using BaseIterator = RangeIterator<const Base>;
+  using BaseSentinel = RangeSentinel<const Base>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Subrange<BaseIterator>;
+    using reference = Subrange<BaseIterator>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(BaseIterator current, BaseSentinel end, size_t count)
+        : m_current(std::move(current)), m_end(std::move(end)), m_count(count) {
+      m_next = advance(m_current);
+    }
+
+    constexpr reference operator*() const { return reference(m_current, m_next); }
+
+    constexpr Iterator& operator++() {
+      m_current = m_next;
+      m_next = advance(m_current);
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+    constexpr bool operator==(std::default_sentinel_t) const { return m_current == m_end; }
+
+   private:
+    constexpr BaseIterator advance(BaseIterator it) const {
+      if constexpr (std::sized_sentinel_for<BaseSentinel, BaseIterator>) {
+        return it + std::min(static_cast<difference_type>(m_count), m_end - it);
+      } else {
+        for (size_t i{}; i < m_count && it != m_end; ++i) {
+          ++it;
+        }
+        return it;
+      }
+    }
+
+    BaseIterator m_current{};
+    BaseIterator m_next{};
+    [[no_unique_address]] BaseSentinel m_end{};
+    size_t m_count{};
+  };
+
+  constexpr ChunkView(Base base, size_t count) : m_base(std::move(base)), m_count(count) {
+    if (count == 0) {
+      throw std::runtime_error("MySTL::Views::chunk: Chunk size must be positive");
+    }
+  }
+
+  [[nodiscard]] constexpr Iterator begin() const {
+    return Iterator(m_base.begin(), m_base.end(), m_count);
+  }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<const Base>
+  {
+    return (static_cast<size_t>(m_base.size()) + m_count - 1) / m_count;
+  }
+
+ private:
+  Base m_base;
+  size_t m_count;
+};
+
+// Walks several ranges in lockstep, stopping at the end of the shortest one
+template <View... Bases>
+class ZipView : public ViewBase {
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<RangeValue<const Bases>...>;
+    using reference = std::tuple<RangeReference<const Bases>...>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(std::tuple<RangeIterator<const Bases>...> current,
+                       std::tuple<RangeSentinel<const Bases>...> end)
+        : m_current(std::move(current)), m_end(std::move(end)) {}
+
+    constexpr reference operator*() const {
+      return std::apply([](const auto&... its) { return reference(*its...); }, m_current);
+    }
+
+    constexpr Iterator& operator++() {
+      std::apply([](auto&... its) { (++its, ...); }, m_current);
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+    constexpr bool operator==(std::default_sentinel_t) const {
+      return [this]<size_t... I>(std::index_sequence<I...>) {
+        return ((std::get<I>(m_current) == std::get<I>(m_end)) || ...);
+      }(std::index_sequence_for<Bases...>{});
+    }
+
+   private:
+    std::tuple<RangeIterator<const Bases>...> m_current{};
+    std::tuple<RangeSentinel<const Bases>...> m_end{};
+  };
+
+  constexpr explicit ZipView(Bases... bases) : m_bases(std::move(bases)...) {}
+
+  [[nodiscard]] constexpr Iterator begin() const {
+    return std::apply(
+        [](const auto&... bases) {
+          return Iterator(std::tuple(bases.begin()...), std::tuple(bases.end()...));
+        },
+        m_bases);
+  }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+  [[nodiscard]] constexpr size_t size() const
+    requires(SizedRange<const Bases> && ...)
+  {
+    return std::apply(
+        [](const auto&... bases) { return std::min({static_cast<size_t>(bases.size())...}); },
+        m_bases);
+  }
+
+ private:
+  std::tuple<Bases...> m_bases;
+};
+
+// Pairs every element with its position, as (index, element)
+template <View Base>
+class EnumerateView : public ViewBase {
+  using BaseIterator = RangeIterator<const Base>;
+  using BaseSentinel = RangeSentinel<const Base>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<size_t, RangeValue<const Base>>;
+    using reference = std::pair<size_t, RangeReference<const Base>>;
+
+    constexpr Iterator() = default;
+    constexpr Iterator(BaseIterator current, BaseSentinel end)
+        : m_current(std::move(current)), m_end(std::move(end)) {}
+
+    constexpr reference operator*() const { return reference(m_index, *m_current); }
+
+    constexpr Iterator& operator++() {
+      ++m_current;
+      ++m_index;
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) {
+      Iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const Iterator& other) const { return m_current == other.m_current; }
+    constexpr bool operator==(std::default_sentinel_t) const { return m_current == m_end; }
+
+   private:
+    BaseIterator m_current{};
+    [[no_unique_address]] BaseSentinel m_end{};
+    size_t m_index{};
+  };
+
+  constexpr explicit EnumerateView(Base base) : m_base(std::move(base)) {}
+
+  [[nodiscard]] constexpr Iterator begin() const { return Iterator(m_base.begin(), m_base.end()); }
+  [[nodiscard]] constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+  [[nodiscard]] constexpr size_t size() const
+    requires SizedRange<const Base>
+  {
+    return m_base.size();
+  }
+
+ private:
+  Base m_base;
+};
+
+template <typename Pred>
+struct FilterAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, FilterAdaptor adaptor) {
+    return FilterView<All<R>, Pred>(all(std::forward<R>(range)), std::move(adaptor.pred));
+  }
+
+  Pred pred;
+};
+
+template <typename Fn>
+struct TransformAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, TransformAdaptor adaptor) {
+    return TransformView<All<R>, Fn>(all(std::forward<R>(range)), std::move(adaptor.fn));
+  }
+
+  Fn fn;
+};
+
+struct TakeAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, TakeAdaptor adaptor) {
+    return TakeView<All<R>>(all(std::forward<R>(range)), adaptor.count);
+  }
+
+  size_t count;
+};
+
+struct ChunkAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, ChunkAdaptor adaptor) {
+    return ChunkView<All<R>>(all(std::forward<R>(range)), adaptor.count);
+  }
+
+  size_t count;
+};
+
+struct EnumerateAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, EnumerateAdaptor) {
+    return EnumerateView<All<R>>(all(std::forward<R>(range)));
+  }
+};
+
+template <typename Pred>
+[[nodiscard]] constexpr FilterAdaptor<std::decay_t<Pred>> filter(Pred&& pred) {
+  return {std::forward<Pred>(pred)};
+}
+
+template <typename Fn>
+[[nodiscard]] constexpr TransformAdaptor<std::decay_t<Fn>> transform(Fn&& fn) {
+  return {std::forward<Fn>(fn)};
+}
+
+[[nodiscard]] constexpr TakeAdaptor take(size_t count) { return {count}; }
+[[nodiscard]] constexpr ChunkAdaptor chunk(size_t count) { return {count}; }
+
+inline constexpr EnumerateAdaptor enumerate{};
+
+template <Range... Rs>
+[[nodiscard]] constexpr auto zip(Rs&&... ranges) {
+  return ZipView<All<Rs>...>(all(std::forward<Rs>(ranges))...);
+}
+
+}  // namespace Views
+
+namespace Detail {
+
+template <typename Container, typename R>
+constexpr Container collect(R&& range) {
+  Container result;
+
+  if constexpr (SizedRange<std::remove_reference_t<R>>) {
+    result.reserve(range.size());
+  }
+
+  for (auto&& item : range) {
+    result.emplace_back(std::forward<decltype(item)>(item));
+  }
+
+  return result;
+}
+
+template <typename Container>
+struct ToAdaptor {
+  template <Range R>
+  friend constexpr Container operator|(R&& range, ToAdaptor) {
+    return collect<Container>(std::forward<R>(range));
+  }
+};
+
+template <template <typename...> class Container>
+struct ToTemplateAdaptor {
+  template <Range R>
+  friend constexpr auto operator|(R&& range, ToTemplateAdaptor) {
+    return collect<Container<RangeValue<std::remove_reference_t<R>>>>(std::forward<R>(range));
+  }
+};
+
+}  // namespace Detail
+
+// Terminal of a pipeline: materializes it into a container, reserving up front when the pipeline
+// knows its length (no filter in the chain). Takes the full type, to<Vector<long>>(), or deduces
+// the element type, to<Vector>().
+template <typename Container>
+[[nodiscard]] constexpr Detail::ToAdaptor<Container> to() {
+  return {};
+}
+
+template <template <typename...> class Container>
+[[nodiscard]] constexpr Detail::ToTemplateAdaptor<Container> to() {
+  return {};
+}
+
+}  // namespace MySTL
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "Source/Vector.hpp"
+
+namespace MySTL {
+
+// Stable reference to an element of a SlotMap. The generation tells apart the different elements
+// that reuse the same slot over time, so a handle to an erased element stays detectably stale.
+struct SlotHandle {
+  static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+  uint32_t index{InvalidIndex};
+  uint32_t generation{};
+
+  [[nodiscard]] constexpr bool operator==(const SlotHandle&) const noexcept = default;
+};
+
+// Elements live packed in a dense Vector so iteration is a linear scan. Handles point into a slot
+// array that maps them to the current dense position; erase moves the last element into the hole
+// (swap-and-pop) and patches its slot, so erase is O(1) and nothing is left behind to skip.
+//
+// Dense order is not stable: erase changes the position of the last element.
+template <typename T>
+class SlotMap {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using Handle = SlotHandle;
+  using Iterator = Vector<T>::Iterator;
+  using ConstIterator = Vector<T>::ConstIterator;
+
+  SlotMap() noexcept = default;
+
+  void reserve(size_t capacity) noexcept {
+    m_values.reserve(capacity);
+    m_denseToSlot.reserve(capacity);
+    m_slots.reserve(capacity);
+  }
+
+  Handle insert(const T& item) { return emplace(item); }
+  Handle insert(T&& item) { return emplace(std::move(item)); }
+
+  template <typename... Args>
+  Handle emplace(Args&&... args) {
+    uint32_t slotIndex;
+
+    if (m_freeHead != SlotHandle::InvalidIndex) {
+      slotIndex = m_freeHead;
+      m_freeHead = m_slots[slotIndex].target;
+    } else {
+      if (m_slots.size() >= SlotHandle::InvalidIndex) {
+        throw std::runtime_error("MySTL::SlotMap: Too many slots");
+      }
+
+      slotIndex = static_cast<uint32_t>(m_slots.size());
+      m_slots.push_back(Slot{});
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    slot.target = static_cast<uint32_t>(m_values.size());
+
+    m_values.emplace_back(std::forward<Args>(args)...);
+    m_denseToSlot.push_back(slotIndex);
+
+    return Handle{slotIndex, slot.generation};
+  }
+
+  // Returns false when the handle was already stale.
+  bool erase(Handle handle) noexcept {
+    if (!contains(handle)) {
+      return false;
+    }
+
+    Slot& slot = m_slots[handle.index];
+    uint32_t dense = slot.target;
+    uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+
+    if (dense != last) {
+      m_values[dense] = std::move(m_values[last]);
+      m_denseToSlot[dense] = m_denseToSlot[last];
+      m_slots[m_denseToSlot[dense]].target = dense;
+    }
+
+    m_values.pop_back();
+    m_denseToSlot.pop_back();
+
+    // A slot whose generation wraps around is retired, old handles could otherwise match again
+    if (++slot.generation != 0) {
+      slot.target = m_freeHead;
+      m_freeHead = handle.index;
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] bool contains(Handle handle) const noexcept {
+    return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation &&
+           m_slots[handle.index].target < m_values.size() &&
+           m_denseToSlot[m_slots[handle.index].target] == handle.index;
+  }
+
+  // nullptr when the handle is stale.
+  [[nodiscard]] T* get(Handle handle) noexcept {
+    return contains(handle) ? &m_values[m_slots[handle.index].target] : nullptr;
+  }
+
+  [[nodiscard]] const T* get(Handle handle) const noexcept {
+    return contains(handle) ? &m_values[m_slots[handle.index].target] : nullptr;
+  }
+
+  // Precondition: contains(handle)
+  [[nodiscard]] reference operator[](Handle handle) noexcept {
+    return m_values[m_slots[handle.index].target];
+  }
+
+  [[nodiscard]] const_reference operator[](Handle handle) const noexcept {
+    return m_values[m_slots[handle.index].target];
+  }
+
+  [[nodiscard]] reference at(Handle handle) {
+    if (!contains(handle)) {
+      throw std::runtime_error("MySTL::SlotMap: Stale handle");
+    }
+
+    return (*this)[handle];
+  }
+
+  [[nodiscard]] const_reference at(Handle handle) const {
+    if (!contains(handle)) {
+      throw std::runtime_error("MySTL::SlotMap: Stale handle");
+    }
+
+    return (*this)[handle];
+  }
+
+  // Handle of the element currently at a dense position, e.g. while iterating.
+  [[nodiscard]] Handle handleAt(size_t dense) const noexcept {
+    uint32_t slotIndex = m_denseToSlot[dense];
+    return Handle{slotIndex, m_slots[slotIndex].generation};
+  }
+
+  void clear() noexcept {
+    // Erasing from the back never moves an element
+    while (!empty()) {
+      erase(handleAt(size() - 1));
+    }
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return m_values.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return m_values.size(); }
+  [[nodiscard]] size_t capacity() const noexcept { return m_values.capacity(); }
+
+  Iterator begin() { return m_values.begin(); }
+  Iterator end() { return m_values.end(); }
+  ConstIterator begin() const { return m_values.begin(); }
+  ConstIterator end() const { return m_values.end(); }
+  ConstIterator cbegin() const { return m_values.cbegin(); }
+  ConstIterator cend() const { return m_values.cend(); }
+
+ private:
+  struct Slot {
+    // Dense position while occupied, next free slot while free
+    uint32_t target{SlotHandle::InvalidIndex};
+    uint32_t generation{};
+  };
+
+  Vector<T> m_values;
+  Vector<uint32_t> m_denseToSlot;
+  Vector<Slot> m_slots;
+  uint32_t m_freeHead{SlotHandle::InvalidIndex};
+};
+
+}  // namespace MySTL
@@ -0,0 +1,509 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "Source/TypeTraits.hpp"
+
+namespace MySTL {
+
+using StringView = std::string_view;
+
+namespace Detail {
+
+// Substring search comparing the first and last needle characters against 16 haystack positions
+// at once (SSE2, baseline on x86-64), only candidates passing both are checked with memcmp. Unlike
+// a memchr driven search it does not degrade when the first character is frequent.
+inline size_t findSubstring(const char* haystack, size_t size, const char* needle,
+                            size_t length) noexcept {
+  if (length == 0) {
+    return 0;
+  }
+
+  if (length > size) {
+    return StringView::npos;
+  }
+
+  if (length == 1) {
+    const void* found = std::memchr(haystack, needle[0], size);
+    return found ? static_cast<const char*>(found) - haystack : StringView::npos;
+  }
+
+  size_t last = size - length;
+  size_t i{};
+
+#if defined(__SSE2__)
+  const __m128i first = _mm_set1_epi8(needle[0]);
+  const __m128i final = _mm_set1_epi8(needle[length - 1]);
+
+  // Candidate mask for the 16 positions starting at offset
+  auto candidates = [&](size_t offset) {
+    __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + offset));
+    __m128i blockLast =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + offset + length - 1));
+    return _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, final));
+  };
+
+  // Four blocks per step, positions are only extracted once a block has a candidate
+  for (; i + 64 <= last + 1; i += 64) {
+    __m128i m0 = candidates(i);
+    __m128i m1 = candidates(i + 16);
+    __m128i m2 = candidates(i + 32);
+    __m128i m3 = candidates(i + 48);
+
+    if (!_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(m0, m1), _mm_or_si128(m2, m3)))) {
+      continue;
+    }
+
+    uint64_t mask = static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m0))) |
+                    static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m1))) << 16 |
+                    static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m2))) << 32 |
+                    static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m3))) << 48;
+
+    while (mask) {
+      size_t candidate = i + std::countr_zero(mask);
+      if (std::memcmp(haystack + candidate + 1, needle + 1, length - 2) == 0) {
+        return candidate;
+      }
+
+      mask &= mask - 1;
+    }
+  }
+
+  for (; i + 16 <= last + 1; i += 16) {
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(candidates(i)));
+
+    while (mask) {
+      size_t candidate = i + std::countr_zero(mask);
+      if (std::memcmp(haystack + candidate + 1, needle + 1, length - 2) == 0) {
+        return candidate;
+      }
+
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  for (; i <= last; ++i) {
+    if (haystack[i] == needle[0] && std::memcmp(haystack + i, needle, length) == 0) {
+      return i;
+    }
+  }
+
+  return StringView::npos;
+}
+
+}  // namespace Detail
+
+// Byte string with small string optimization: up to 23 characters are kept inline in the object
+// itself, which is 24 bytes with a stateless allocator. Longer strings live on the heap.
+//
+// The last inline byte holds 23 - size() for small strings, so it doubles as the null terminator
+// of a full 23 character string. For heap strings the same byte is the top byte of the capacity
+// word and carries HeapFlag. Nothing points into the object, so it is trivially relocatable.
+template <typename Allocator = std::allocator<char>>
+class BasicString {
+ public:
+  using value_type = char;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using reference = char&;
+  using const_reference = const char&;
+  using pointer = char*;
+  using const_pointer = const char*;
+  using Iterator = char*;
+  using ConstIterator = const char*;
+
+  static constexpr size_t npos = StringView::npos;
+  static constexpr size_t SmallCapacity = 23;
+
+  static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, char>,
+                "String allocator must allocate char");
+  static_assert(std::endian::native == std::endian::little,
+                "String layout relies on a little endian capacity word");
+
+  BasicString() noexcept(noexcept(Allocator())) : BasicString(Allocator()) {}
+
+  explicit BasicString(const Allocator& alloc) noexcept : m_alloc(alloc) { setSmallSize(0); }
+
+  BasicString(const char* str, const Allocator& alloc = Allocator())
+      : BasicString(StringView(str), alloc) {}
+
+  explicit BasicString(StringView str, const Allocator& alloc = Allocator()) : m_alloc(alloc) {
+    init(str.data(), str.size());
+  }
+
+  BasicString(size_t count, char ch, const Allocator& alloc = Allocator()) : m_alloc(alloc) {
+    char* data = init(nullptr, count);
+    std::memset(data, ch, count);
+  }
+
+  BasicString(const BasicString& other)
+      : m_alloc(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+            other.m_alloc)) {
+    if (!other.isHeap()) {
+      m_storage = other.m_storage;
+      return;
+    }
+
+    init(other.data(), other.size());
+  }
+
+  BasicString(BasicString&& other) noexcept
+      : m_storage(other.m_storage), m_alloc(std::move(other.m_alloc)) {
+    other.setSmallSize(0);
+  }
+
+  ~BasicString() { release(); }
+
+  BasicString& operator=(const BasicString& other) {
+    if (&other != this) {
+      assign(other.view());
+    }
+
+    return *this;
+  }
+
+  BasicString& operator=(BasicString&& other) noexcept {
+    if (&other == this) {
+      return *this;
+    }
+
+    release();
+    m_storage = other.m_storage;
+    m_alloc = std::move(other.m_alloc);
+    other.setSmallSize(0);
+    return *this;
+  }
+
+  BasicString& operator=(StringView str) { return assign(str); }
+  BasicString& operator=(const char* str) { return assign(StringView(str)); }
+
+  BasicString& assign(StringView str) {
+    // str may point into this string, reserve would invalidate it
+    if (str.size() > capacity()) {
+      BasicString copy(str, m_alloc);
+      return *this = std::move(copy);
+    }
+
+    if (!str.empty()) {
+      std::memmove(data(), str.data(), str.size());
+    }
+    setSize(str.size());
+    return *this;
+  }
+
+  void reserve(size_t capacity) {
+    if (capacity <= this->capacity()) {
+      return;
+    }
+
+    char* newData = std::allocator_traits<Allocator>::allocate(m_alloc, capacity + 1);
+    size_t size = this->size();
+    std::memcpy(newData, data(), size + 1);
+
+    release();
+    m_storage.heap = Heap{newData, size, capacity | HeapFlag};
+  }
+
+  void shrink_to_fit() {
+    if (!isHeap() || capacity() == size()) {
+      return;
+    }
+
+    BasicString copy(view(), m_alloc);
+    *this = std::move(copy);
+  }
+
+  void resize(size_t size, char ch = '\0') {
+    size_t oldSize = this->size();
+    if (size > capacity()) {
+      reserve(std::max(size, grownCapacity()));
+    }
+
+    if (size > oldSize) {
+      std::memset(data() + oldSize, ch, size - oldSize);
+    }
+
+    setSize(size);
+  }
+
+  void clear() noexcept { setSize(0); }
+
+  void push_back(char ch) {
+    size_t size = this->size();
+    if (size == capacity()) {
+      reserve(grownCapacity());
+    }
+
+    data()[size] = ch;
+    setSize(size + 1);
+  }
+
+  void pop_back() noexcept {
+    if (!empty()) {
+      setSize(size() - 1);
+    }
+  }
+
+  BasicString& append(StringView str) {
+    if (str.empty()) {
+      return *this;
+    }
+
+    size_t size = this->size();
+
+    if (size + str.size() > capacity()) {
+      // str may point into this string, grow into a new buffer before releasing the old one
+      BasicString grown(m_alloc);
+      grown.reserve(std::max(size + str.size(), grownCapacity()));
+      std::memcpy(grown.data(), data(), size);
+      std::memcpy(grown.data() + size, str.data(), str.size());
+      grown.setSize(size + str.size());
+      return *this = std::move(grown);
+    }
+
+    std::memmove(data() + size, str.data(), str.size());
+    setSize(size + str.size());
+    return *this;
+  }
+
+  BasicString& append(size_t count, char ch) {
+    size_t size = this->size();
+    reserve(std::max(size + count, size + count > capacity() ? grownCapacity() : 0));
+    std::memset(data() + size, ch, count);
+    setSize(size + count);
+    return *this;
+  }
+
+  BasicString& operator+=(StringView str) { return append(str); }
+  BasicString& operator+=(const char* str) { return append(StringView(str)); }
+  BasicString& operator+=(char ch) {
+    push_back(ch);
+    return *this;
+  }
+
+  [[nodiscard]] size_t find(StringView str, size_t pos = 0) const noexcept {
+    if (pos > size()) {
+      return npos;
+    }
+
+    size_t found = Detail::findSubstring(data() + pos, size() - pos, str.data(), str.size());
+    return found == npos ? npos : found + pos;
+  }
+
+  [[nodiscard]] size_t find(char ch, size_t pos = 0) const noexcept {
+    if (pos >= size()) {
+      return npos;
+    }
+
+    const void* found = std::memchr(data() + pos, ch, size() - pos);
+    return found ? static_cast<const char*>(found) - data() : npos;
+  }
+
+  [[nodiscard]] bool contains(StringView str) const noexcept { return find(str) != npos; }
+  [[nodiscard]] bool starts_with(StringView str) const noexcept { return view().starts_with(str); }
+  [[nodiscard]] bool ends_with(StringView str) const noexcept { return view().ends_with(str); }
+
+  // StringView compares through memcmp, which the C library already vectorizes, and skips it for
+  // empty views whose data() may be null
+  [[nodiscard]] int compare(StringView str) const noexcept { return view().compare(str); }
+
+  [[nodiscard]] BasicString substr(size_t pos = 0, size_t count = npos) const {
+    if (pos > size()) {
+      throw std::runtime_error("MySTL::String: Index out of bound");
+    }
+
+    return BasicString(view().substr(pos, count), m_alloc);
+  }
+
+  [[nodiscard]] char& operator[](size_t index) noexcept { return data()[index]; }
+  [[nodiscard]] const char& operator[](size_t index) const noexcept { return data()[index]; }
+
+  [[nodiscard]] char& at(size_t index) {
+    if (index >= size()) {
+      throw std::runtime_error("MySTL::String: Index out of bound");
+    }
+
+    return data()[index];
+  }
+
+  [[nodiscard]] const char& at(size_t index) const {
+    if (index >= size()) {
+      throw std::runtime_error("MySTL::String: Index out of bound");
+    }
+
+    return data()[index];
+  }
+
+  [[nodiscard]] char& front() noexcept { return data()[0]; }
+  [[nodiscard]] const char& front() const noexcept { return data()[0]; }
+  [[nodiscard]] char& back() noexcept { return data()[size() - 1]; }
+  [[nodiscard]] const char& back() const noexcept { return data()[size() - 1]; }
+
+  [[nodiscard]] char* data() noexcept { return isHeap() ? m_storage.heap.data : m_storage.small; }
+  [[nodiscard]] const char* data() const noexcept {
+    return isHeap() ? m_storage.heap.data : m_storage.small;
+  }
+
+  [[nodiscard]] const char* c_str() const noexcept { return data(); }
+
+  [[nodiscard]] StringView view() const noexcept { return StringView(data(), size()); }
+  operator StringView() const noexcept { return view(); }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] bool isSmall() const noexcept { return !isHeap(); }
+
+  [[nodiscard]] size_t size() const noexcept {
+    return isHeap() ? m_storage.heap.size : SmallCapacity - smallTag();
+  }
+
+  [[nodiscard]] size_t length() const noexcept { return size(); }
+
+  [[nodiscard]] size_t capacity() const noexcept {
+    return isHeap() ? m_storage.heap.capacity & ~HeapFlag : SmallCapacity;
+  }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept { return m_alloc; }
+
+  Iterator begin() noexcept { return data(); }
+  Iterator end() noexcept { return data() + size(); }
+  ConstIterator begin() const noexcept { return data(); }
+  ConstIterator end() const noexcept { return data() + size(); }
+  ConstIterator cbegin() const noexcept { return data(); }
+  ConstIterator cend() const noexcept { return data() + size(); }
+
+ private:
+  static constexpr size_t HeapFlag = size_t{1} << (sizeof(size_t) * 8 - 1);
+
+  struct Heap {
+    char* data;
+    size_t size;
+    size_t capacity;  // Top bit is HeapFlag
+  };
+
+  union Storage {
+    Heap heap;
+    char small[sizeof(Heap)];
+  };
+
+  static_assert(sizeof(Heap) == SmallCapacity + 1, "Inline storage must match the heap layout");
+
+  [[nodiscard]] unsigned char smallTag() const noexcept {
+    unsigned char tag;
+    std::memcpy(&tag, m_storage.small + SmallCapacity, 1);
+    return tag;
+  }
+
+  [[nodiscard]] bool isHeap() const noexcept { return smallTag() & 0x80; }
+
+  void setSmallSize(size_t size) noexcept {
+    m_storage.small[size] = '\0';
+    m_storage.small[SmallCapacity] = static_cast<char>(SmallCapacity - size);
+  }
+
+  void setSize(size_t size) noexcept {
+    if (isHeap()) {
+      m_storage.heap.size = size;
+      m_storage.heap.data[size] = '\0';
+    } else {
+      setSmallSize(size);
+    }
+  }
+
+  [[nodiscard]] size_t grownCapacity() const noexcept { return capacity() * 2; }
+
+  // Sets up storage for size characters, copying them from str when given.
+  char* init(const char* str, size_t size) {
+    char* data;
+
+    if (size <= SmallCapacity) {
+      data = m_storage.small;
+      setSmallSize(size);
+    } else {
+      data = std::allocator_traits<Allocator>::allocate(m_alloc, size + 1);
+      data[size] = '\0';
+      m_storage.heap = Heap{data, size, size | HeapFlag};
+    }
+
+    if (str) {
+      std::memcpy(data, str, size);
+    }
+
+    return data;
+  }
+
+  void release() noexcept {
+    if (isHeap()) {
+      std::allocator_traits<Allocator>::deallocate(m_alloc, m_storage.heap.data, capacity() + 1);
+    }
+  }
+
+  Storage m_storage{};
+  [[no_unique_address]] Allocator m_alloc;
+};
+
+using String = BasicString<>;
+
+// Stateless allocators such as std::allocator are not trivially copyable but have nothing to
+// relocate either.
+template <typename Allocator>
+struct is_trivially_relocatable<BasicString<Allocator>>
+    : std::bool_constant<std::is_empty_v<Allocator> || is_trivially_relocatable_v<Allocator>> {};
+
+template <typename Allocator>
+[[nodiscard]] bool operator==(const BasicString<Allocator>& lhs, StringView rhs) noexcept {
+  return lhs.view() == rhs;
+}
+
+template <typename Allocator>
+[[nodiscard]] bool operator==(const BasicString<Allocator>& lhs,
+                              const BasicString<Allocator>& rhs) noexcept {
+  return lhs == rhs.view();
+}
+
+template <typename Allocator>
+[[nodiscard]] bool operator==(const BasicString<Allocator>& lhs, const char* rhs) noexcept {
+  return lhs == StringView(rhs);
+}
+
+template <typename Allocator>
+[[nodiscard]] std::strong_ordering operator<=>(const BasicString<Allocator>& lhs,
+                                               StringView rhs) noexcept {
+  return lhs.compare(rhs) <=> 0;
+}
+
+template <typename Allocator>
+[[nodiscard]] std::strong_ordering operator<=>(const BasicString<Allocator>& lhs,
+                                               const BasicString<Allocator>& rhs) noexcept {
+  return lhs.compare(rhs.view()) <=> 0;
+}
+
+template <typename Allocator>
+[[nodiscard]] BasicString<Allocator> operator+(const BasicString<Allocator>& lhs, StringView rhs) {
+  BasicString<Allocator> result(lhs.get_allocator());
+  result.reserve(lhs.size() + rhs.size());
+  result.append(lhs.view());
+  result.append(rhs);
+  return result;
+}
+
+}  // namespace MySTL
+
+template <typename Allocator>
+struct std::hash<MySTL::BasicString<Allocator>> {
+  size_t operator()(const MySTL::BasicString<Allocator>& str) const noexcept {
+    return std::hash<std::string_view>{}(str.view());
+  }
+};
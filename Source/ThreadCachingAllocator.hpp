@@ -0,0 +1,606 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "Source/Vector.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MySTL {
+
+struct ThreadCachingStats {
+  size_t chunks{};
+  size_t heaps{};
+  size_t numaNodes{};
+  size_t centralTransfers{};
+  size_t remoteFrees{};
+};
+
+namespace Detail {
+
+// Small requests are served from 256 KiB chunks aligned to their size, so the chunk header of any
+// block is one mask away. Each chunk holds blocks of a single size class and belongs to one thread
+// heap at a time.
+inline constexpr size_t TcChunkSize = 256 * 1024;
+inline constexpr size_t TcChunkHeaderSize = 128;
+inline constexpr size_t TcMaxSmallSize = 16 * 1024;
+inline constexpr size_t TcMinAlignment = 16;
+inline constexpr size_t TcSizeClassCount = 36;
+inline constexpr size_t TcMaxNumaNodes = 64;
+
+// 16, 32, 48, 64, then four steps per power of two up to 16 KiB: at most a quarter of a block is
+// wasted
+[[nodiscard]] constexpr size_t tcSizeClass(size_t bytes) noexcept {
+  if (bytes <= 64) {
+    return bytes == 0 ? 0 : (bytes - 1) / 16;
+  }
+
+  size_t last = bytes - 1;
+  size_t exponent = static_cast<size_t>(std::bit_width(last)) - 1;
+  size_t base = size_t{1} << exponent;
+  return 4 + (exponent - 6) * 4 + (last - base) / (base / 4);
+}
+
+[[nodiscard]] constexpr size_t tcClassSize(size_t sizeClass) noexcept {
+  if (sizeClass < 4) {
+    return (sizeClass + 1) * 16;
+  }
+
+  size_t base = size_t{64} << ((sizeClass - 4) / 4);
+  return base + ((sizeClass - 4) % 4 + 1) * (base / 4);
+}
+
+// Blocks carved off a chunk's untouched tail at once: about 32 KiB, 4 to 64 blocks
+[[nodiscard]] constexpr uint32_t tcBatchSize(size_t sizeClass) noexcept {
+  return static_cast<uint32_t>(std::clamp<size_t>(32 * 1024 / tcClassSize(sizeClass), 4, 64));
+}
+
+static_assert(tcSizeClass(TcMaxSmallSize) == TcSizeClassCount - 1);
+static_assert(tcClassSize(TcSizeClassCount - 1) == TcMaxSmallSize);
+static_assert(tcSizeClass(tcClassSize(17)) == 17 && tcSizeClass(tcClassSize(17) + 1) == 18);
+
+// Raw syscalls so there is no libnuma dependency. Every call degrades to "one node" when the kernel
+// or the container refuses it.
+inline constexpr int TcMpolPreferred = 1;
+inline constexpr unsigned long TcMpolMemsAllowed = 1ul << 2;
+
+[[nodiscard]] inline uint64_t tcAllowedNumaNodes() noexcept {
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+  // The kernel rejects masks shorter than its possible node count, so ask with room for 1024
+  unsigned long mask[1024 / (8 * sizeof(unsigned long))]{};
+  if (syscall(SYS_get_mempolicy, nullptr, mask, 1024, nullptr, TcMpolMemsAllowed) == 0) {
+    return static_cast<uint64_t>(mask[0]);
+  }
+#endif
+  return 0;
+}
+
+[[nodiscard]] inline unsigned tcCurrentNumaNode() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu{};
+  unsigned node{};
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return node;
+  }
+#endif
+  return 0;
+}
+
+// Prefers, rather than binds, so a full node spills over instead of failing the allocation
+inline void tcBindToNode(void* memory, size_t bytes, unsigned node) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+  unsigned long mask = 1ul << node;
+  (void)syscall(SYS_mbind, memory, bytes, TcMpolPreferred, &mask, 8 * sizeof(mask) + 1, 0);
+#else
+  (void)memory;
+  (void)bytes;
+  (void)node;
+#endif
+}
+
+struct TcBlock {
+  TcBlock* next;
+};
+
+class TcHeap;
+
+// Chunk header. The owning heap's thread is the only one touching the free list, the bump range and
+// the ring links; any thread may push onto the remote stack, which sits on its own cache line.
+// Ownership only moves with the whole chunk, through the central pool, so a block is always cached
+// by the heap that will hand it out next.
+struct TcChunk {
+  std::atomic<TcHeap*> owner;
+  uint32_t sizeClass;
+  uint32_t node;
+  // Blocks handed out, including remote frees not collected yet; zero means the chunk is empty
+  uint32_t used;
+  TcBlock* freeList;
+  char* bump;
+  char* bumpEnd;
+  TcChunk* prev;
+  TcChunk* next;
+  alignas(64) std::atomic<TcBlock*> remote;
+
+  // Starts over as an empty chunk of the given class, carved downwards from the end
+  void format(size_t blockClass) noexcept {
+    size_t size = tcClassSize(blockClass);
+    sizeClass = static_cast<uint32_t>(blockClass);
+    used = 0;
+    freeList = nullptr;
+    bump = reinterpret_cast<char*>(this) + TcChunkHeaderSize;
+    bumpEnd = bump + (TcChunkSize - TcChunkHeaderSize) / size * size;
+  }
+
+  void push(void* ptr) noexcept {
+    auto* block = static_cast<TcBlock*>(ptr);
+    block->next = freeList;
+    freeList = block;
+    --used;
+  }
+
+  [[nodiscard]] void* pop() noexcept {
+    TcBlock* block = freeList;
+    freeList = block->next;
+    ++used;
+    return block;
+  }
+
+  // Moves a batch of never used blocks onto the free list
+  void carve() noexcept {
+    size_t size = tcClassSize(sizeClass);
+    uint32_t batch = tcBatchSize(sizeClass);
+    for (uint32_t i{}; i < batch && bump != bumpEnd; ++i) {
+      bumpEnd -= size;
+      auto* block = reinterpret_cast<TcBlock*>(bumpEnd);
+      block->next = freeList;
+      freeList = block;
+    }
+  }
+
+  // Lock-free push from any thread: a multi-producer stack whose consumer only ever exchanges the
+  // whole list, so there is no ABA
+  void pushRemote(void* ptr) noexcept {
+    auto* block = static_cast<TcBlock*>(ptr);
+    block->next = remote.load(std::memory_order_relaxed);
+    while (!remote.compare_exchange_weak(block->next, block, std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+
+  // Moves every remotely freed block onto the local free list and returns how many there were
+  [[nodiscard]] size_t collectRemote() noexcept {
+    if (remote.load(std::memory_order_relaxed) == nullptr) {
+      return 0;
+    }
+
+    TcBlock* block = remote.exchange(nullptr, std::memory_order_acquire);
+    size_t count{};
+    while (block != nullptr) {
+      TcBlock* next = block->next;
+      push(block);
+      block = next;
+      ++count;
+    }
+    return count;
+  }
+};
+
+static_assert(sizeof(TcChunk) <= TcChunkHeaderSize);
+
+[[nodiscard]] inline TcChunk* tcChunkOf(void* ptr) noexcept {
+  return reinterpret_cast<TcChunk*>(reinterpret_cast<uintptr_t>(ptr) & ~(TcChunkSize - 1));
+}
+
+// Per-thread cache: for every size class, a ring of the chunks the heap owns, entered at the chunk
+// it allocates from. Only the owning thread touches the rings.
+class TcHeap {
+ public:
+  TcChunk* current[TcSizeClassCount]{};
+  std::atomic<size_t> remoteFrees{};
+  uint32_t node{};
+  bool abandoned{};
+
+  // Inserts a chunk into its ring just before another one, or as the only chunk
+  void link(TcChunk& chunk, TcChunk* before) noexcept {
+    if (before == nullptr) {
+      chunk.prev = &chunk;
+      chunk.next = &chunk;
+      return;
+    }
+
+    chunk.prev = before->prev;
+    chunk.next = before;
+    before->prev->next = &chunk;
+    before->prev = &chunk;
+  }
+
+  void unlink(TcChunk& chunk) noexcept {
+    TcChunk*& entry = current[chunk.sizeClass];
+    if (entry == &chunk) {
+      entry = chunk.next == &chunk ? nullptr : chunk.next;
+    }
+
+    chunk.prev->next = chunk.next;
+    chunk.next->prev = chunk.prev;
+  }
+
+  // Collects a chunk's remote frees, counting them towards the heap's statistics
+  void collectRemote(TcChunk& chunk) noexcept {
+    if (size_t count = chunk.collectRemote(); count != 0) {
+      remoteFrees.store(remoteFrees.load(std::memory_order_relaxed) + count,
+                        std::memory_order_relaxed);
+    }
+  }
+};
+
+// Chunks a heap gave up: the partly used ones of one size class, or the empty ones that any class
+// can reformat
+struct TcCentralList {
+  std::mutex mutex;
+  Vector<TcChunk*> chunks;
+};
+
+struct TcArena {
+  TcCentralList partial[TcSizeClassCount];
+  TcCentralList empty;
+};
+
+// Process-wide state: one central pool per NUMA node, the registry of heaps and chunks, and the
+// heaps left behind by exited threads. Never destroyed, so blocks freed during static destruction
+// and thread exit still have somewhere to go.
+class ThreadCachePool {
+ public:
+  // How many chunks of its ring a heap searches for free blocks before it takes another chunk
+  static constexpr size_t RingScanLimit = 8;
+
+  [[nodiscard]] static ThreadCachePool& instance() noexcept {
+    static ThreadCachePool* pool = new ThreadCachePool();
+    return *pool;
+  }
+
+  ThreadCachePool(const ThreadCachePool&) = delete;
+  ThreadCachePool& operator=(const ThreadCachePool&) = delete;
+
+  [[nodiscard]] void* allocate(TcHeap& heap, size_t sizeClass) {
+    TcChunk* chunk = heap.current[sizeClass];
+    if (chunk == nullptr || chunk->freeList == nullptr) [[unlikely]] {
+      chunk = refill(heap, sizeClass);
+    }
+
+    return chunk->pop();
+  }
+
+  // Frees by the owning thread stay in its cache; an empty chunk other than the one being
+  // allocated from goes back to the central pool
+  void deallocate(TcHeap& heap, void* ptr) noexcept {
+    TcChunk* chunk = tcChunkOf(ptr);
+    if (chunk->owner.load(std::memory_order_relaxed) != &heap) [[unlikely]] {
+      chunk->pushRemote(ptr);
+      return;
+    }
+
+    chunk->push(ptr);
+    if (chunk->used == 0 && chunk != heap.current[chunk->sizeClass]) [[unlikely]] {
+      release(heap, *chunk);
+    }
+  }
+
+  // Reuses a heap abandoned on the same node before creating one
+  [[nodiscard]] TcHeap* acquireHeap() {
+    uint32_t node = localNode();
+    std::lock_guard lock(m_registryMutex);
+
+    for (TcHeap* heap : m_heaps) {
+      if (heap->abandoned && heap->node == node) {
+        heap->abandoned = false;
+        return heap;
+      }
+    }
+
+    auto* heap = new TcHeap();
+    heap->node = node;
+    m_heaps.push_back(heap);
+    return heap;
+  }
+
+  // Called at thread exit: every chunk goes to the central pool, where any thread of the node can
+  // take it over along with the blocks still freed into it
+  void releaseHeap(TcHeap& heap) noexcept {
+    for (TcChunk*& current : heap.current) {
+      while (current != nullptr) {
+        heap.collectRemote(*current);
+        release(heap, *current);
+      }
+    }
+
+    std::lock_guard lock(m_registryMutex);
+    heap.abandoned = true;
+  }
+
+  // Used once a thread's cache is gone but its thread_local destructors still allocate
+  [[nodiscard]] void* allocateFallback(size_t sizeClass) {
+    std::lock_guard lock(m_fallbackMutex);
+    return allocate(m_fallback, sizeClass);
+  }
+
+  void deallocateFallback(void* ptr) noexcept { tcChunkOf(ptr)->pushRemote(ptr); }
+
+  [[nodiscard]] ThreadCachingStats stats() {
+    ThreadCachingStats stats;
+    stats.numaNodes = m_numaNodes;
+    stats.centralTransfers = m_centralTransfers.load(std::memory_order_relaxed);
+
+    std::lock_guard lock(m_registryMutex);
+    stats.chunks = m_chunks.size();
+    stats.heaps = m_heaps.size();
+    stats.remoteFrees = m_fallback.remoteFrees.load(std::memory_order_relaxed);
+    for (TcHeap* heap : m_heaps) {
+      stats.remoteFrees += heap->remoteFrees.load(std::memory_order_relaxed);
+    }
+
+    return stats;
+  }
+
+ private:
+  ThreadCachePool() {
+    uint64_t nodes = tcAllowedNumaNodes();
+    m_allowedNodes = nodes;
+    m_numaNodes = std::max<size_t>(static_cast<size_t>(std::popcount(nodes)), 1);
+    m_arenas = std::make_unique<TcArena[]>(
+        m_numaNodes > 1 ? static_cast<size_t>(std::bit_width(nodes)) : 1);
+  }
+
+  [[nodiscard]] uint32_t localNode() const noexcept {
+    if (m_numaNodes <= 1) {
+      return 0;
+    }
+
+    unsigned node = tcCurrentNumaNode();
+    if (node >= TcMaxNumaNodes || (m_allowedNodes >> node & 1) == 0) {
+      node = static_cast<unsigned>(std::countr_zero(m_allowedNodes));
+    }
+    return node;
+  }
+
+  // Cheapest source first: blocks freed into the next few chunks of the ring, locally or by other
+  // threads, then the untouched tail of one of them, a chunk from the node's central pool, and only
+  // then a fresh chunk. Each failed search resumes where the previous one stopped.
+  [[nodiscard]] TcChunk* refill(TcHeap& heap, size_t sizeClass) {
+    TcChunk* start = heap.current[sizeClass];
+    TcChunk* chunk = start;
+    TcChunk* carvable = nullptr;
+
+    for (size_t i{}; chunk != nullptr && i < RingScanLimit; ++i) {
+      heap.collectRemote(*chunk);
+      if (chunk->freeList != nullptr) {
+        heap.current[sizeClass] = chunk;
+        return chunk;
+      }
+      if (carvable == nullptr && chunk->bump != chunk->bumpEnd) {
+        carvable = chunk;
+      }
+
+      chunk = chunk->next;
+      if (chunk == start) {
+        break;
+      }
+    }
+
+    if (carvable != nullptr) {
+      carvable->carve();
+      heap.current[sizeClass] = carvable;
+      return carvable;
+    }
+
+    // Chunks taken over full stay in the ring until their blocks come back
+    while (TcChunk* taken = takeCentral(heap, sizeClass)) {
+      heap.link(*taken, chunk);
+      heap.current[sizeClass] = taken;
+      heap.collectRemote(*taken);
+      if (taken->freeList == nullptr) {
+        taken->carve();
+      }
+      if (taken->freeList != nullptr) {
+        return taken;
+      }
+    }
+
+    TcChunk* fresh = newChunk(heap, sizeClass);
+    heap.link(*fresh, chunk);
+    heap.current[sizeClass] = fresh;
+    fresh->carve();
+    return fresh;
+  }
+
+  [[nodiscard]] TcChunk* newChunk(TcHeap& heap, size_t sizeClass) {
+    void* memory = ::operator new(TcChunkSize, std::align_val_t{TcChunkSize});
+    if (m_numaNodes > 1) {
+      tcBindToNode(memory, TcChunkSize, heap.node);
+    }
+
+    auto* chunk = new (memory) TcChunk{};
+    chunk->owner.store(&heap, std::memory_order_relaxed);
+    chunk->node = heap.node;
+    chunk->format(sizeClass);
+
+    std::lock_guard lock(m_registryMutex);
+    m_chunks.push_back(memory);
+    return chunk;
+  }
+
+  // Hands a chunk to the central pool. Threads still holding its blocks free them onto the remote
+  // stack, which the next owner collects.
+  void release(TcHeap& heap, TcChunk& chunk) noexcept {
+    heap.unlink(chunk);
+    chunk.owner.store(nullptr, std::memory_order_relaxed);
+
+    TcArena& arena = m_arenas[chunk.node];
+    TcCentralList& list = chunk.used == 0 ? arena.empty : arena.partial[chunk.sizeClass];
+    std::lock_guard lock(list.mutex);
+    list.chunks.push_back(&chunk);
+    m_centralTransfers.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Takes over a partly used chunk of the class, or else reformats an empty one
+  [[nodiscard]] TcChunk* takeCentral(TcHeap& heap, size_t sizeClass) noexcept {
+    TcArena& arena = m_arenas[heap.node];
+    TcChunk* chunk = popCentral(arena.partial[sizeClass]);
+    if (chunk == nullptr) {
+      chunk = popCentral(arena.empty);
+      if (chunk == nullptr) {
+        return nullptr;
+      }
+      chunk->format(sizeClass);
+    }
+
+    chunk->owner.store(&heap, std::memory_order_relaxed);
+    m_centralTransfers.fetch_add(1, std::memory_order_relaxed);
+    return chunk;
+  }
+
+  [[nodiscard]] static TcChunk* popCentral(TcCentralList& list) noexcept {
+    std::lock_guard lock(list.mutex);
+    if (list.chunks.empty()) {
+      return nullptr;
+    }
+
+    TcChunk* chunk = list.chunks.back();
+    list.chunks.pop_back();
+    return chunk;
+  }
+
+  std::unique_ptr<TcArena[]> m_arenas;
+  uint64_t m_allowedNodes{};
+  size_t m_numaNodes{};
+  std::atomic<size_t> m_centralTransfers{};
+
+  std::mutex m_registryMutex;
+  Vector<TcHeap*> m_heaps;
+  Vector<void*> m_chunks;
+
+  std::mutex m_fallbackMutex;
+  TcHeap m_fallback;
+};
+
+// The heap pointer is trivially destructible so it stays readable while other thread_local
+// destructors run; the guard below hands the heap back when the thread exits.
+inline thread_local TcHeap* tcLocalHeap = nullptr;
+inline thread_local bool tcThreadExited = false;
+
+struct TcThreadGuard {
+  ~TcThreadGuard() {
+    if (tcLocalHeap != nullptr) {
+      ThreadCachePool::instance().releaseHeap(*tcLocalHeap);
+    }
+    tcLocalHeap = nullptr;
+    tcThreadExited = true;
+  }
+};
+
+// nullptr once the thread is exiting
+[[nodiscard]] inline TcHeap* tcAttachThread() {
+  if (tcThreadExited) {
+    return nullptr;
+  }
+
+  thread_local TcThreadGuard guard;
+  (void)guard;
+  tcLocalHeap = ThreadCachePool::instance().acquireHeap();
+  return tcLocalHeap;
+}
+
+[[nodiscard]] inline void* tcAllocate(size_t bytes, size_t alignment) {
+  if (bytes > TcMaxSmallSize || alignment > TcMinAlignment) [[unlikely]] {
+    return ::operator new(bytes, std::align_val_t{std::max(alignment, TcMinAlignment)});
+  }
+
+  size_t sizeClass = tcSizeClass(bytes);
+  TcHeap* heap = tcLocalHeap;
+  if (heap == nullptr) [[unlikely]] {
+    heap = tcAttachThread();
+    if (heap == nullptr) {
+      return ThreadCachePool::instance().allocateFallback(sizeClass);
+    }
+  }
+
+  return ThreadCachePool::instance().allocate(*heap, sizeClass);
+}
+
+inline void tcDeallocate(void* ptr, size_t bytes, size_t alignment) noexcept {
+  if (bytes > TcMaxSmallSize || alignment > TcMinAlignment) [[unlikely]] {
+    ::operator delete(ptr, std::align_val_t{std::max(alignment, TcMinAlignment)});
+    return;
+  }
+
+  TcHeap* heap = tcLocalHeap;
+  if (heap == nullptr) [[unlikely]] {
+    ThreadCachePool::instance().deallocateFallback(ptr);
+    return;
+  }
+
+  ThreadCachePool::instance().deallocate(*heap, ptr);
+}
+
+}  // namespace Detail
+
+[[nodiscard]] inline ThreadCachingStats threadCachingStats() {
+  return Detail::ThreadCachePool::instance().stats();
+}
+
+// Stateless allocator in front of per-thread size-class caches. Requests up to 16 KiB are served
+// without locks from the calling thread's cache; the cache trades whole chunks with a
+// per-NUMA-node central pool when it runs dry, when a chunk empties and when the thread exits.
+// Blocks freed by another thread go back to the chunk's owner through a lock-free remote stack, so
+// memory stays with the node it was placed on.
+// Larger or over-aligned requests go straight to ::operator new.
+template <typename T>
+class ThreadCachingAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = ThreadCachingAllocator<U>;
+  };
+
+  constexpr ThreadCachingAllocator() noexcept = default;
+
+  template <typename U>
+  constexpr ThreadCachingAllocator(const ThreadCachingAllocator<U>&) noexcept {}
+
+  [[nodiscard]] T* allocate(size_type n) {
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+
+    return static_cast<T*>(Detail::tcAllocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, size_type n) noexcept {
+    Detail::tcDeallocate(ptr, n * sizeof(T), alignof(T));
+  }
+};
+
+template <typename T, typename U>
+[[nodiscard]] constexpr bool operator==(const ThreadCachingAllocator<T>&,
+                                        const ThreadCachingAllocator<U>&) noexcept {
+  return true;
+}
+
+}  // namespace MySTL
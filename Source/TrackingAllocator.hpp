@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace MySTL {
+
+struct AllocationStats {
+  std::atomic<size_t> allocations{};
+  std::atomic<size_t> deallocations{};
+  std::atomic<size_t> bytesAllocated{};
+  std::atomic<size_t> liveBytes{};
+  std::atomic<size_t> peakBytes{};
+
+  void recordAllocation(size_t bytes) noexcept {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    size_t live = liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t peak = peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+  }
+
+  void recordDeallocation(size_t bytes) noexcept {
+    deallocations.fetch_add(1, std::memory_order_relaxed);
+    liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  // Clears the counters but keeps live bytes, so the peak restarts from what is currently held.
+  void reset() noexcept {
+    allocations.store(0, std::memory_order_relaxed);
+    deallocations.store(0, std::memory_order_relaxed);
+    bytesAllocated.store(0, std::memory_order_relaxed);
+    peakBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+};
+
+// Shared by every default constructed TrackingAllocator, whatever its value_type.
+[[nodiscard]] inline AllocationStats& defaultAllocationStats() noexcept {
+  static AllocationStats stats;
+  return stats;
+}
+
+// Forwards to Upstream and records every allocation in an AllocationStats. Copies and rebinds share
+// the same stats, so a container and the nodes it allocates are accounted together.
+template <typename T, typename Upstream = std::allocator<T>>
+class TrackingAllocator {
+ public:
+  using value_type = T;
+  using upstream_type = std::allocator_traits<Upstream>::template rebind_alloc<T>;
+  using size_type = std::allocator_traits<upstream_type>::size_type;
+  using pointer = std::allocator_traits<upstream_type>::pointer;
+
+  template <typename U>
+  struct rebind {
+    using other =
+        TrackingAllocator<U, typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+  };
+
+  constexpr TrackingAllocator() noexcept : m_stats(&defaultAllocationStats()) {}
+  explicit constexpr TrackingAllocator(AllocationStats& stats,
+                                       const Upstream& upstream = Upstream()) noexcept
+      : m_upstream(upstream), m_stats(&stats) {}
+
+  template <typename U, typename OtherUpstream>
+  constexpr TrackingAllocator(const TrackingAllocator<U, OtherUpstream>& other) noexcept
+      : m_upstream(other.upstream()), m_stats(&other.stats()) {}
+
+  [[nodiscard]] pointer allocate(size_type n) {
+    pointer ptr = std::allocator_traits<upstream_type>::allocate(m_upstream, n);
+    m_stats->recordAllocation(n * sizeof(T));
+    return ptr;
+  }
+
+  void deallocate(pointer ptr, size_type n) noexcept {
+    m_stats->recordDeallocation(n * sizeof(T));
+    std::allocator_traits<upstream_type>::deallocate(m_upstream, ptr, n);
+  }
+
+  [[nodiscard]] constexpr AllocationStats& stats() const noexcept { return *m_stats; }
+  [[nodiscard]] constexpr const upstream_type& upstream() const noexcept { return m_upstream; }
+
+ private:
+  upstream_type m_upstream;
+  AllocationStats* m_stats;
+};
+
+template <typename T, typename U, typename UpstreamT, typename UpstreamU>
+[[nodiscard]] constexpr bool operator==(const TrackingAllocator<T, UpstreamT>& a1,
+                                        const TrackingAllocator<U, UpstreamU>& a2) noexcept {
+  return &a1.stats() == &a2.stats() && a1.upstream() == a2.upstream();
+}
+
+}  // namespace MySTL
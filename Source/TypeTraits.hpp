@@ -0,0 +1,16 @@
+#pragma once
+
+#include <type_traits>
+
+namespace MySTL {
+
+// Objects that can be moved to new storage with a plain memcpy, skipping the move constructor and
+// the destructor of the source. Containers use it to grow with one bulk copy. Types that do not
+// point into themselves (e.g. MySTL::String) can opt in by specializing this trait.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+}  // namespace MySTL
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -38,15 +39,12 @@ class UniquePointer {
   UniquePointer& operator=(const UniquePointer&) = delete;
 
   UniquePointer(UniquePointer&& other) noexcept
-      : m_ptr(other.m_ptr), m_deleter(std::move(other.m_deleter)) {
-    other.reset(nullptr);
-  }
+      : m_ptr(other.release()), m_deleter(std::move(other.m_deleter)) {}
 
   [[nodiscard]] UniquePointer& operator=(UniquePointer&& other) noexcept {
     if (&other != this) {
-      reset(nullptr);
-      m_ptr = other.m_ptr;
-      other.reset(nullptr);
+      reset(other.release());
+      m_deleter = std::move(other.m_deleter);
     }
 
     return *this;
@@ -65,7 +63,7 @@ class UniquePointer {
     }
   }
 
-  constexpr void reset(std::nullptr_t = nullptr) noexcept { reset(); }
+  constexpr void reset(std::nullptr_t = nullptr) noexcept { reset(static_cast<T*>(nullptr)); }
 
   [[nodiscard]] constexpr T* release() { return std::exchange(m_ptr, nullptr); }
 
@@ -147,6 +145,42 @@ inline std::ostream operator<<(std::ostream& os, const UniquePointer<T, Deleter>
   return os;
 }
 
+// Destroys and frees through the allocator allocate_unique obtained the object from
+template <typename T, typename Allocator>
+struct AllocatorDeleter {
+  using allocator_type = std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+  constexpr AllocatorDeleter() noexcept = default;
+  explicit constexpr AllocatorDeleter(const Allocator& alloc) noexcept : m_alloc(alloc) {}
+
+  constexpr void operator()(T* ptr) {
+    if (ptr != nullptr) {
+      std::allocator_traits<allocator_type>::destroy(m_alloc, ptr);
+      std::allocator_traits<allocator_type>::deallocate(m_alloc, ptr, 1);
+    }
+  }
+
+  allocator_type m_alloc;
+};
+
+template <typename T, typename Allocator, typename... Args>
+[[nodiscard]] inline MySTL::UniquePointer<T, AllocatorDeleter<T, Allocator>> allocate_unique(
+    const Allocator& alloc, Args&&... args) {
+  using Traits = std::allocator_traits<typename AllocatorDeleter<T, Allocator>::allocator_type>;
+  typename AllocatorDeleter<T, Allocator>::allocator_type rebound(alloc);
+
+  T* ptr = Traits::allocate(rebound, 1);
+  try {
+    Traits::construct(rebound, ptr, std::forward<Args>(args)...);
+  } catch (...) {
+    Traits::deallocate(rebound, ptr, 1);
+    throw;
+  }
+
+  return MySTL::UniquePointer<T, AllocatorDeleter<T, Allocator>>(
+      ptr, AllocatorDeleter<T, Allocator>(alloc));
+}
+
 template <typename T, typename Deleter = DefaultDeleter<T>, typename... Args>
 inline MySTL::UniquePointer<T, Deleter> make_unique(Args&&... args) noexcept {
   return MySTL::UniquePointer<T, Deleter>(new T(std::forward<Args>(args)...));
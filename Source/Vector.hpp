@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <utility>
+
+#include "Source/TypeTraits.hpp"
 
 namespace MySTL {
 
@@ -21,15 +26,19 @@ class Vector {
 
   struct Iterator {
     using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::contiguous_iterator_tag;
     using difference_type = std::ptrdiff_t;
     using value_type = T;
+    using element_type = T;
     using pointer = T*;
     using reference = T&;
 
+    Iterator() noexcept = default;
     explicit Iterator(pointer ptr) noexcept : m_ptr(ptr) {}
 
     reference operator*() const { return *m_ptr; }
     pointer operator->() const { return m_ptr; }
+    reference operator[](difference_type n) const { return m_ptr[n]; }
 
     Iterator& operator++() {
       ++m_ptr;
@@ -54,6 +63,7 @@ class Vector {
     }
 
     Iterator operator+(difference_type n) const { return Iterator(m_ptr + n); }
+    friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
     Iterator operator-(difference_type n) const { return Iterator(m_ptr - n); }
     difference_type operator-(const Iterator& other) const { return m_ptr - other.m_ptr; }
 
@@ -75,20 +85,26 @@ class Vector {
     bool operator>=(const Iterator& other) const { return m_ptr >= other.m_ptr; }
 
    private:
-    pointer m_ptr;
+    pointer m_ptr{nullptr};
   };
 
   struct ConstIterator {
     using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::contiguous_iterator_tag;
     using difference_type = std::ptrdiff_t;
     using value_type = T;
+    using element_type = const T;
     using pointer = const T*;
     using reference = const T&;
 
+    ConstIterator() noexcept = default;
     explicit ConstIterator(pointer ptr) noexcept : m_ptr(ptr) {}
 
+    ConstIterator(const Iterator& it) noexcept : m_ptr(it.operator->()) {}
+
     reference operator*() const { return *m_ptr; }
     pointer operator->() const { return m_ptr; }
+    reference operator[](difference_type n) const { return m_ptr[n]; }
 
     ConstIterator& operator++() {
       ++m_ptr;
@@ -113,8 +129,9 @@ class Vector {
     }
 
     ConstIterator operator+(difference_type n) const { return ConstIterator(m_ptr + n); }
+    friend ConstIterator operator+(difference_type n, const ConstIterator& it) { return it + n; }
     ConstIterator operator-(difference_type n) const { return ConstIterator(m_ptr - n); }
-    difference_type operator-(const ConstIterator& other) const { return m_ptr - other.ptr; }
+    difference_type operator-(const ConstIterator& other) const { return m_ptr - other.m_ptr; }
 
     ConstIterator& operator+=(difference_type n) {
       m_ptr += n;
@@ -134,7 +151,7 @@ class Vector {
     bool operator>=(const ConstIterator& other) const { return m_ptr >= other.m_ptr; }
 
    private:
-    pointer m_ptr;
+    pointer m_ptr{nullptr};
   };
 
   explicit constexpr Vector(const Allocator& alloc = Allocator()) noexcept : m_alloc(alloc) {};
@@ -168,20 +185,27 @@ class Vector {
     }
   };
 
-  constexpr Vector(Vector&& other, const Allocator& alloc = Allocator{}) noexcept : m_alloc(alloc) {
-    reserve(other.m_capacity);
-    m_size = other.m_size;
-    m_data = other.m_data;
+  constexpr Vector(Vector&& other) noexcept
+      : m_alloc(std::move(other.m_alloc)),
+        m_capacity(std::exchange(other.m_capacity, 0)),
+        m_size(std::exchange(other.m_size, 0)),
+        m_data(std::exchange(other.m_data, nullptr)) {};
+
+  constexpr Vector(Vector&& other, const Allocator& alloc) noexcept : m_alloc(alloc) {
+    if (m_alloc == other.m_alloc) {
+      m_capacity = std::exchange(other.m_capacity, 0);
+      m_size = std::exchange(other.m_size, 0);
+      m_data = std::exchange(other.m_data, nullptr);
+      return;
+    }
 
-    other.clear();
+    reserve(other.m_size);
 
-    if (other.m_data) {
-      std::allocator_traits<Allocator>::deallocate(other.m_alloc, other.m_data, other.m_capacity);
+    for (size_t i{}; i < other.m_size; ++i) {
+      push_back(std::move(other.m_data[i]));
     }
 
-    other.m_capacity = 0;
-    other.m_size = 0;
-    other.m_data = nullptr;
+    other.clear();
   };
 
   constexpr ~Vector() noexcept {
@@ -201,6 +225,7 @@ class Vector {
       return *this;
     }
 
+    clear();
     reserve(other.size());
 
     for (size_t i{}; i < other.size(); ++i) {
@@ -217,18 +242,14 @@ class Vector {
 
     clear();
 
-    reserve(other.m_capacity);
-    m_size = other.m_size;
-    m_data = other.m_data;
-
-    other.clear();
-    if (other.m_data) {
-      std::allocator_traits<Allocator>::deallocate(other.m_alloc, other.m_data, other.m_capacity);
+    if (m_data) {
+      std::allocator_traits<Allocator>::deallocate(m_alloc, m_data, m_capacity);
     }
 
-    other.m_size = 0;
-    other.m_capacity = 0;
-    other.m_data = nullptr;
+    m_alloc = std::move(other.m_alloc);
+    m_capacity = std::exchange(other.m_capacity, 0);
+    m_size = std::exchange(other.m_size, 0);
+    m_data = std::exchange(other.m_data, nullptr);
     return *this;
   };
 
@@ -249,13 +270,15 @@ class Vector {
 
     pointer newData = std::allocator_traits<Allocator>::allocate(m_alloc, capacity);
 
-    if (m_data) {
+    if (m_data && is_trivially_relocatable_v<T> && !std::is_constant_evaluated()) {
+      std::memcpy(static_cast<void*>(std::to_address(newData)),
+                  static_cast<const void*>(std::to_address(m_data)), m_size * sizeof(T));
+      std::allocator_traits<Allocator>::deallocate(m_alloc, m_data, m_capacity);
+    } else if (m_data) {
       for (size_t i{}; i < m_size; ++i) {
         std::allocator_traits<Allocator>::construct(m_alloc, newData + i, std::move(m_data[i]));
       }
-    }
 
-    if (m_data) {
       for (size_t i{}; i < m_size; i++) {
         std::allocator_traits<Allocator>::destroy(m_alloc, m_data + i);
       }
@@ -372,7 +395,7 @@ class Vector {
       return;
     }
 
-    std::allocator_traits<Allocator>::destroy(m_alloc, m_data + m_size--);
+    std::allocator_traits<Allocator>::destroy(m_alloc, m_data + --m_size);
   }
 
   template <typename... Args>
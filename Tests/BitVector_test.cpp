@@ -0,0 +1,155 @@
+#include "Source/BitVector.hpp"
+
+#include <gtest/gtest.h>
+
+using TBits = MySTL::BitVector;
+
+TEST(BitVector, AppliesRuleOfFive) {
+  EXPECT_TRUE(std::is_constructible_v<TBits>);
+  EXPECT_TRUE(std::is_destructible_v<TBits>);
+  EXPECT_TRUE(std::is_copy_assignable_v<TBits>);
+  EXPECT_TRUE(std::is_copy_constructible_v<TBits>);
+  EXPECT_TRUE(std::is_move_assignable_v<TBits>);
+  EXPECT_TRUE(std::is_move_constructible_v<TBits>);
+}
+
+TEST(BitVector, PacksSixtyFourFlagsPerWord) {
+  TBits bits(130, true);
+
+  EXPECT_EQ(bits.size(), 130);
+  EXPECT_EQ(bits.num_words(), 3);
+  EXPECT_EQ(bits.count(), 130);
+  EXPECT_EQ(bits.words()[2], 0b11);
+}
+
+TEST(BitVector, SetResetAndFlipSingleBits) {
+  TBits bits(100);
+
+  bits.set(3).set(64).flip(99);
+  EXPECT_TRUE(bits[3]);
+  EXPECT_TRUE(bits[64]);
+  EXPECT_TRUE(bits[99]);
+
+  bits.reset(64).flip(99);
+  EXPECT_FALSE(bits[64]);
+  EXPECT_FALSE(bits[99]);
+  EXPECT_EQ(bits.count(), 1);
+}
+
+TEST(BitVector, AtMethodThrowsOutOfBoundError) {
+  TBits bits(10);
+  EXPECT_THROW((void)bits.at(10), std::runtime_error);
+}
+
+TEST(BitVector, PushBackAndResizeKeepPaddingClear) {
+  TBits bits;
+
+  for (size_t i{}; i < 70; ++i) {
+    bits.push_back(i % 2 == 0);
+  }
+
+  EXPECT_EQ(bits.size(), 70);
+  EXPECT_EQ(bits.count(), 35);
+
+  bits.resize(66);
+  EXPECT_EQ(bits.count(), 33);
+
+  bits.resize(200, true);
+  EXPECT_EQ(bits.count(), 33 + 134);
+
+  bits.pop_back();
+  EXPECT_EQ(bits.size(), 199);
+  EXPECT_EQ(bits.count(), 33 + 133);
+}
+
+TEST(BitVector, BulkWordOperations) {
+  TBits a(100);
+  TBits b(100);
+  a.set(1).set(2).set(70);
+  b.set(2).set(70).set(99);
+
+  EXPECT_EQ((a & b).count(), 2);
+  EXPECT_EQ((a | b).count(), 4);
+  EXPECT_EQ((a ^ b).count(), 2);
+
+  TBits inverted = ~a;
+  EXPECT_EQ(inverted.count(), 97);
+  EXPECT_FALSE(inverted[70]);
+  EXPECT_EQ(inverted.num_words(), 2);
+}
+
+TEST(BitVector, AllAnyNone) {
+  TBits bits(65);
+  EXPECT_TRUE(bits.none());
+
+  bits.set();
+  EXPECT_TRUE(bits.all());
+  EXPECT_TRUE(bits.any());
+}
+
+TEST(BitVector, FindFirstAndNextSetBit) {
+  TBits bits(300);
+  bits.set(5).set(64).set(299);
+
+  EXPECT_EQ(bits.find_first(), 5);
+  EXPECT_EQ(bits.find_next(5), 64);
+  EXPECT_EQ(bits.find_next(64), 299);
+  EXPECT_EQ(bits.find_next(299), TBits::npos);
+  EXPECT_EQ(TBits(10).find_first(), TBits::npos);
+}
+
+TEST(BitVector, FindNextPastTheEndReturnsNpos) {
+  TBits bits(10, true);
+
+  EXPECT_EQ(bits.find_next(TBits::npos), TBits::npos);
+  EXPECT_EQ(bits.find_next(9), TBits::npos);
+  EXPECT_EQ(bits.find_next(10), TBits::npos);
+  EXPECT_EQ(TBits().find_next(0), TBits::npos);
+}
+
+TEST(BitVector, RankAndSelectWithAndWithoutIndex) {
+  TBits bits(2000);
+  for (size_t i{}; i < bits.size(); i += 3) {
+    bits.set(i);
+  }
+
+  for (int pass{}; pass < 2; ++pass) {
+    EXPECT_EQ(bits.rank(0), 0);
+    EXPECT_EQ(bits.rank(1), 1);
+    EXPECT_EQ(bits.rank(1000), 334);
+    EXPECT_EQ(bits.rank(bits.size()), bits.count());
+
+    EXPECT_EQ(bits.select(0), 0);
+    EXPECT_EQ(bits.select(200), 600);
+    EXPECT_EQ(bits.select(666), 1998);
+    EXPECT_EQ(bits.select(667), TBits::npos);
+
+    bits.buildRankIndex();
+    EXPECT_TRUE(bits.hasRankIndex());
+  }
+
+  bits.set(1);
+  EXPECT_FALSE(bits.hasRankIndex());
+  EXPECT_EQ(bits.rank(1000), 335);
+}
+
+TEST(BitVector, SampledSelectMatchesScanAcrossDensities) {
+  // Dense, half full and sparse vectors; the denser ones span many select samples
+  for (size_t stride : {1, 2, 37, 1000}) {
+    TBits bits(200000);
+    for (size_t i{}; i < bits.size(); i += stride) {
+      bits.set(i);
+    }
+    bits.set(199999);
+
+    TBits scanned = bits;
+    bits.buildRankIndex();
+    ASSERT_EQ(bits.count(), scanned.count());
+
+    for (size_t k{}; k <= bits.count(); k += 97) {
+      ASSERT_EQ(bits.select(k), scanned.select(k)) << "stride " << stride << " k " << k;
+    }
+    EXPECT_EQ(bits.select(bits.count() - 1), 199999);
+    EXPECT_EQ(bits.select(bits.count()), TBits::npos);
+  }
+}
@@ -0,0 +1,112 @@
+#include "Source/DeltaVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "Source/Vector.hpp"
+
+// Timestamps with irregular gaps, including repeats and a few large jumps
+static MySTL::Vector<uint64_t> timestamps(size_t count) {
+  MySTL::Vector<uint64_t> values;
+  uint64_t value = 1700000000000ull;
+
+  for (size_t i{}; i < count; ++i) {
+    value += (i * 7919) % 13;
+    if (i % 500 == 499) {
+      value += 1ull << 40;
+    }
+    values.push_back(value);
+  }
+
+  return values;
+}
+
+static MySTL::DeltaVector build(const MySTL::Vector<uint64_t>& values) {
+  MySTL::DeltaVector vector;
+  for (uint64_t value : values) {
+    vector.push_back(value);
+  }
+  return vector;
+}
+
+TEST(DeltaVector, GetReturnsSealedAndTailValues) {
+  MySTL::Vector<uint64_t> values = timestamps(1000);
+  MySTL::DeltaVector vector = build(values);
+
+  EXPECT_EQ(vector.size(), 1000);
+  EXPECT_EQ(vector.num_blocks(), 7);
+  EXPECT_EQ(vector.back(), values.back());
+
+  for (size_t i{}; i < values.size(); ++i) {
+    ASSERT_EQ(vector[i], values[i]) << "index " << i;
+  }
+}
+
+TEST(DeltaVector, DecodeMatchesInput) {
+  MySTL::Vector<uint64_t> values = timestamps(1000);
+  MySTL::DeltaVector vector = build(values);
+
+  MySTL::Vector<uint64_t> out(1000, 0);
+  vector.decode(0, 1000, &out[0]);
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), out.begin()));
+
+  vector.decode(100, 800, &out[0]);
+  EXPECT_TRUE(std::equal(values.begin() + 100, values.begin() + 900, out.begin()));
+}
+
+TEST(DeltaVector, PacksSmallGapsTightly) {
+  MySTL::DeltaVector vector;
+  for (uint64_t i{}; i < 128 * 100; ++i) {
+    vector.push_back(1000000 + i * 3);
+  }
+
+  // Gaps of 3 fit in 2 bits: 4 words per block
+  EXPECT_EQ(vector.num_words(), 100 * 4 + 2);
+  EXPECT_LT(vector.storageBytes() * 8 / vector.size(), 5);
+}
+
+TEST(DeltaVector, HandlesRepeatedValues) {
+  MySTL::DeltaVector vector;
+  for (size_t i{}; i < 300; ++i) {
+    vector.push_back(42);
+  }
+
+  EXPECT_EQ(vector.num_words(), 2);
+  EXPECT_EQ(vector[0], 42);
+  EXPECT_EQ(vector[299], 42);
+  EXPECT_EQ(vector.lower_bound(42), 0);
+  EXPECT_EQ(vector.lower_bound(43), 300);
+}
+
+TEST(DeltaVector, LowerBoundMatchesStd) {
+  MySTL::Vector<uint64_t> values = timestamps(2000);
+  MySTL::DeltaVector vector = build(values);
+
+  for (size_t i{}; i < values.size(); i += 37) {
+    for (uint64_t probe : {values[i] - 1, values[i], values[i] + 1}) {
+      auto expected = static_cast<size_t>(std::lower_bound(values.begin(), values.end(), probe) -
+                                          values.begin());
+      ASSERT_EQ(vector.lower_bound(probe), expected) << "probe " << probe;
+    }
+  }
+
+  EXPECT_EQ(vector.lower_bound(0), 0);
+  EXPECT_EQ(vector.lower_bound(values.back() + 1), values.size());
+  EXPECT_TRUE(vector.contains(values[1234]));
+  EXPECT_FALSE(vector.contains(values[1234] + (1ull << 39)));
+}
+
+TEST(DeltaVector, RejectsDecreasingValues) {
+  MySTL::DeltaVector vector;
+  vector.push_back(10);
+  vector.push_back(10);
+
+  EXPECT_THROW(vector.push_back(9), std::runtime_error);
+  EXPECT_THROW((void)vector.at(2), std::runtime_error);
+
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+  vector.push_back(1);
+  EXPECT_EQ(vector[0], 1);
+}
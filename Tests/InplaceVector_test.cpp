@@ -0,0 +1,135 @@
+#include "Source/InplaceVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using TVector = MySTL::InplaceVector<int, 8>;
+
+TEST(InplaceVector, AppliesRuleOfFive) {
+  EXPECT_TRUE(std::is_constructible_v<TVector>);
+  EXPECT_TRUE(std::is_destructible_v<TVector>);
+  EXPECT_TRUE(std::is_copy_assignable_v<TVector>);
+  EXPECT_TRUE(std::is_copy_constructible_v<TVector>);
+  EXPECT_TRUE(std::is_move_assignable_v<TVector>);
+  EXPECT_TRUE(std::is_move_constructible_v<TVector>);
+}
+
+TEST(InplaceVector, IsTriviallyCopyableWhenElementIs) {
+  EXPECT_TRUE(std::is_trivially_copyable_v<TVector>);
+  EXPECT_FALSE((std::is_trivially_copyable_v<MySTL::InplaceVector<std::string, 4>>));
+}
+
+TEST(InplaceVector, UsableInConstantExpressions) {
+  constexpr auto v = [] {
+    TVector v{1, 2};
+    v.push_back(3);
+    v.emplace(0, 0);
+    v.pop_back();
+    return v;
+  }();
+
+  static_assert(v.size() == 3);
+  static_assert(v[0] == 0 && v[1] == 1 && v[2] == 2);
+}
+
+TEST(InplaceVector, ConstructAndRepeatAnObject) {
+  TVector v(3, 1);
+
+  EXPECT_EQ(v.size(), 3);
+  for (size_t i{}; i < v.size(); ++i) {
+    EXPECT_EQ(v[i], 1);
+  }
+}
+
+TEST(InplaceVector, CapacityIsFixed) {
+  TVector v;
+  EXPECT_EQ(v.capacity(), 8);
+  EXPECT_THROW(v.reserve(9), std::bad_alloc);
+  EXPECT_THROW(TVector(9, 0), std::bad_alloc);
+}
+
+TEST(InplaceVector, PushBackThrowsWhenFull) {
+  TVector v(8, 0);
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back(1), std::bad_alloc);
+}
+
+TEST(InplaceVector, TryPushBackReturnsNullWhenFull) {
+  MySTL::InplaceVector<int, 2> v;
+
+  int* first = v.try_push_back(1);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(*first, 1);
+
+  EXPECT_NE(v.try_emplace_back(2), nullptr);
+  EXPECT_EQ(v.try_push_back(3), nullptr);
+  EXPECT_EQ(v.size(), 2);
+}
+
+TEST(InplaceVector, ResizeWithDefaultElement) {
+  TVector v{2, 1};
+
+  v.resize(5);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v.back(), 0);
+
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_EQ(v.back(), 2);
+}
+
+TEST(InplaceVector, InsertManyItemInSelectedPosition) {
+  TVector v{2, 1};
+
+  v.insert(1, 3, 3);
+
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v.front(), 2);
+  EXPECT_EQ(v.back(), 1);
+  EXPECT_EQ(v[1], 3);
+  EXPECT_EQ(v[2], 3);
+  EXPECT_EQ(v[3], 3);
+}
+
+TEST(InplaceVector, EmplaceItemInSelectedPosition) {
+  MySTL::InplaceVector<std::string, 4> v{"a", "c"};
+
+  v.emplace(1, "b");
+
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "b");
+  EXPECT_EQ(v[2], "c");
+}
+
+TEST(InplaceVector, CopiesAndMovesNonTrivialElements) {
+  MySTL::InplaceVector<std::string, 4> v{"long enough to skip small string storage", "b"};
+
+  auto copy = v;
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[0], v[0]);
+
+  auto moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(moved[1], "b");
+
+  copy = moved;
+  EXPECT_EQ(copy[0], moved[0]);
+}
+
+TEST(InplaceVector, AtMethodThrowsOutOfBoundError) {
+  TVector v{2, 1};
+  EXPECT_THROW((void)v.at(3), std::runtime_error);
+}
+
+TEST(InplaceVector, IteratesInOrder) {
+  TVector v{1, 2, 3};
+
+  int sum{};
+  for (int item : v) {
+    sum = sum * 10 + item;
+  }
+
+  EXPECT_EQ(sum, 123);
+}
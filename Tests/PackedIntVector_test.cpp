@@ -0,0 +1,120 @@
+#include "Source/PackedIntVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Source/Vector.hpp"
+
+static uint64_t pattern(size_t index, unsigned width) {
+  uint64_t value = index * 0x9E3779B97F4A7C15ull;
+  return value & MySTL::Detail::lowBitsMask(width);
+}
+
+TEST(PackedIntVector, StoresValuesInFixedWidth) {
+  MySTL::PackedIntVector<20> vector;
+
+  for (size_t i{}; i < 1000; ++i) {
+    vector.push_back(pattern(i, 20));
+  }
+
+  EXPECT_EQ(vector.size(), 1000);
+  EXPECT_EQ(vector.bitWidth(), 20);
+  for (size_t i{}; i < 1000; ++i) {
+    ASSERT_EQ(vector[i], pattern(i, 20));
+  }
+
+  // 8 blocks of 40 words plus the two trailing words, against 1000 words unpacked
+  EXPECT_EQ(vector.num_words(), 8 * 40 + 2);
+}
+
+TEST(PackedIntVector, RoundTripsEveryRuntimeWidth) {
+  for (unsigned width{1}; width <= 64; ++width) {
+    MySTL::PackedIntVector<> vector(width);
+
+    for (size_t i{}; i < 300; ++i) {
+      vector.push_back(pattern(i, width));
+    }
+
+    for (size_t i{}; i < 300; ++i) {
+      ASSERT_EQ(vector.get(i), pattern(i, width)) << "width " << width << " index " << i;
+    }
+  }
+}
+
+TEST(PackedIntVector, DecodeMatchesGetForEveryWidth) {
+  for (unsigned width{1}; width <= 64; ++width) {
+    MySTL::PackedIntVector<> vector(width);
+    for (size_t i{}; i < 700; ++i) {
+      vector.push_back(pattern(i, width));
+    }
+
+    // Unaligned head, whole blocks and a partial tail
+    uint64_t out[700];
+    vector.decode(5, 690, out);
+    for (size_t i{}; i < 690; ++i) {
+      ASSERT_EQ(out[i], pattern(i + 5, width)) << "width " << width << " index " << i + 5;
+    }
+  }
+}
+
+TEST(PackedIntVector, SetOverwritesOnlyItsValue) {
+  MySTL::PackedIntVector<13> vector;
+  for (size_t i{}; i < 256; ++i) {
+    vector.push_back(pattern(i, 13));
+  }
+
+  vector.set(9, 0x1FFF);
+  vector.set(10, 0);
+
+  EXPECT_EQ(vector[8], pattern(8, 13));
+  EXPECT_EQ(vector[9], 0x1FFF);
+  EXPECT_EQ(vector[10], 0);
+  EXPECT_EQ(vector[11], pattern(11, 13));
+}
+
+TEST(PackedIntVector, RejectsValuesAndWidthsOutOfRange) {
+  MySTL::PackedIntVector<4> vector;
+  vector.push_back(15);
+
+  EXPECT_THROW(vector.push_back(16), std::runtime_error);
+  EXPECT_THROW(vector.set(0, 16), std::runtime_error);
+  EXPECT_THROW((void)vector.at(1), std::runtime_error);
+  EXPECT_THROW(MySTL::PackedIntVector<>(0), std::runtime_error);
+  EXPECT_THROW(MySTL::PackedIntVector<>(65), std::runtime_error);
+}
+
+TEST(PackedIntVector, FromValuesPicksNarrowestWidth) {
+  MySTL::Vector<uint64_t> values{3, 1000, 7, 1023};
+
+  auto vector = MySTL::PackedIntVector<>::fromValues(values);
+
+  EXPECT_EQ(vector.bitWidth(), 10);
+  EXPECT_EQ(vector.size(), 4);
+  EXPECT_EQ(vector[3], 1023);
+
+  uint64_t sum{};
+  for (uint64_t value : vector) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 3 + 1000 + 7 + 1023);
+}
+
+TEST(PackedIntVector, PopBackReleasesEmptyBlocks) {
+  MySTL::PackedIntVector<7> vector;
+  for (size_t i{}; i < 129; ++i) {
+    vector.push_back(i % 128);
+  }
+  EXPECT_EQ(vector.num_words(), 2 * 14 + 2);
+
+  vector.pop_back();
+  EXPECT_EQ(vector.num_words(), 14 + 2);
+
+  vector.push_back(100);
+  EXPECT_EQ(vector[128], 100);
+  EXPECT_EQ(vector[127], 127);
+
+  while (!vector.empty()) {
+    vector.pop_back();
+  }
+  vector.push_back(5);
+  EXPECT_EQ(vector[0], 5);
+}
@@ -0,0 +1,190 @@
+#include "Source/PersistentVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using TVector = MySTL::PersistentVector<int>;
+
+static TVector makeSequence(int count) {
+  auto transient = TVector().transient();
+
+  for (int i{}; i < count; ++i) {
+    transient.push_back(i);
+  }
+
+  return transient.persistent();
+}
+
+TEST(PersistentVector, AppliesRuleOfFive) {
+  EXPECT_TRUE(std::is_constructible_v<TVector>);
+  EXPECT_TRUE(std::is_destructible_v<TVector>);
+  EXPECT_TRUE(std::is_copy_assignable_v<TVector>);
+  EXPECT_TRUE(std::is_copy_constructible_v<TVector>);
+  EXPECT_TRUE(std::is_move_assignable_v<TVector>);
+  EXPECT_TRUE(std::is_move_constructible_v<TVector>);
+}
+
+TEST(PersistentVector, ConstructWithInitializerList) {
+  TVector v{0, 1, 2, 3, 4};
+
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_EQ(v.back(), 4);
+}
+
+TEST(PersistentVector, PushBackReturnsNewVersion) {
+  TVector empty;
+  TVector one = empty.push_back(1);
+  TVector two = one.push_back(2);
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(one.size(), 1);
+  EXPECT_EQ(two.size(), 2);
+  EXPECT_EQ(two[1], 2);
+}
+
+TEST(PersistentVector, GrowsAcrossSeveralTrieLevels) {
+  // 32 * 32 * 32 + extra needs a root of depth three
+  const int count = 40000;
+  TVector v;
+  for (int i{}; i < count; ++i) {
+    v = v.push_back(i);
+  }
+
+  ASSERT_EQ(v.size(), count);
+  for (int i{}; i < count; ++i) {
+    ASSERT_EQ(v[i], i);
+  }
+}
+
+TEST(PersistentVector, SetKeepsOlderVersionsUnchanged) {
+  TVector v = makeSequence(5000);
+
+  TVector updated = v.set(10, -1).set(4999, -2);
+
+  EXPECT_EQ(v[10], 10);
+  EXPECT_EQ(v[4999], 4999);
+  EXPECT_EQ(updated[10], -1);
+  EXPECT_EQ(updated[4999], -2);
+  EXPECT_EQ(updated[11], 11);
+}
+
+TEST(PersistentVector, PopBackShrinksTrie) {
+  const int count = 1100;
+  TVector v = makeSequence(count);
+  TVector original = v;
+
+  for (int i{count}; i > 0; --i) {
+    ASSERT_EQ(v.back(), i - 1);
+    v = v.pop_back();
+  }
+
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(original.size(), count);
+  EXPECT_EQ(original[count - 1], count - 1);
+
+  v = v.push_back(7);
+  EXPECT_EQ(v[0], 7);
+}
+
+TEST(PersistentVector, TransientDoesNotChangeFrozenVersions) {
+  TVector base = makeSequence(100);
+
+  auto transient = base.transient();
+  transient.set(0, -1).push_back(100);
+  TVector first = transient.persistent();
+
+  transient.set(0, -2).pop_back();
+  TVector second = transient.persistent();
+
+  EXPECT_EQ(base[0], 0);
+  EXPECT_EQ(base.size(), 100);
+  EXPECT_EQ(first[0], -1);
+  EXPECT_EQ(first.size(), 101);
+  EXPECT_EQ(second[0], -2);
+  EXPECT_EQ(second.size(), 100);
+}
+
+TEST(PersistentVector, MovedTransientDoesNotChangeFrozenVersions) {
+  static_assert(!std::is_copy_constructible_v<TVector::Transient>);
+  static_assert(!std::is_copy_assignable_v<TVector::Transient>);
+
+  auto transient = makeSequence(100).transient();
+  transient.set(1, 2);
+  TVector snapshot = transient.persistent();
+
+  auto moved = std::move(transient);
+  moved.set(1, 77).push_back(100);
+  TVector edited = moved.persistent();
+
+  auto reassigned = TVector().transient();
+  reassigned = std::move(moved);
+  reassigned.set(1, 78);
+
+  EXPECT_EQ(snapshot[1], 2);
+  EXPECT_EQ(snapshot.size(), 100);
+  EXPECT_EQ(edited[1], 77);
+  EXPECT_EQ(edited.size(), 101);
+  EXPECT_EQ(reassigned[1], 78);
+}
+
+TEST(PersistentVector, AtMethodThrowsOutOfBoundError) {
+  TVector v{2, 1};
+  EXPECT_THROW((void)v.at(3), std::runtime_error);
+  EXPECT_THROW((void)v.set(2, 0), std::runtime_error);
+}
+
+TEST(PersistentVector, IteratesInOrder) {
+  TVector v = makeSequence(100);
+
+  int expected{};
+  for (int item : v) {
+    EXPECT_EQ(item, expected++);
+  }
+
+  EXPECT_EQ(expected, 100);
+}
+
+TEST(PersistentVector, HoldsNonTrivialElements) {
+  MySTL::PersistentVector<std::string> v{"a", "b"};
+  auto updated = v.set(0, "long enough to skip small string storage");
+
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(updated[0], "long enough to skip small string storage");
+}
+
+TEST(AtomicPersistentVector, ReadersSeeCompleteVersions) {
+  MySTL::AtomicPersistentVector<int> table(TVector(64, 0));
+  std::vector<std::thread> readers;
+
+  for (int r{}; r < 4; ++r) {
+    readers.emplace_back([&table] {
+      for (int i{}; i < 2000; ++i) {
+        auto snapshot = table.load();
+        int first = (*snapshot)[0];
+        for (int item : *snapshot) {
+          ASSERT_EQ(item, first);
+        }
+      }
+    });
+  }
+
+  for (int version{1}; version < 200; ++version) {
+    table.update([version](const TVector& current) {
+      auto transient = current.transient();
+      for (size_t i{}; i < current.size(); ++i) {
+        transient.set(i, version);
+      }
+      return transient.persistent();
+    });
+  }
+
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ((*table.load())[63], 199);
+}
@@ -0,0 +1,213 @@
+#include "Source/PriorityQueue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+
+#include "Source/Vector.hpp"
+
+static MySTL::Vector<int> shuffled(int count) {
+  MySTL::Vector<int> values;
+  for (int i{}; i < count; ++i) {
+    values.push_back((i * 7919) % count);
+  }
+  return values;
+}
+
+TEST(PriorityQueue, PopsInDescendingOrder) {
+  MySTL::PriorityQueue<int> queue;
+
+  for (int value : shuffled(1000)) {
+    queue.push(value);
+  }
+
+  EXPECT_EQ(queue.size(), 1000);
+  for (int expected{999}; expected >= 0; --expected) {
+    ASSERT_EQ(queue.top(), expected);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(PriorityQueue, GreaterMakesMinHeapForEveryArity) {
+  MySTL::PriorityQueue<int, std::greater<int>, 2> binary;
+  MySTL::PriorityQueue<int, std::greater<int>, 3> ternary;
+  MySTL::PriorityQueue<int, std::greater<int>, 8> octary;
+
+  for (int value : shuffled(500)) {
+    binary.push(value);
+    ternary.push(value);
+    octary.push(value);
+  }
+
+  for (int expected{}; expected < 500; ++expected) {
+    ASSERT_EQ(binary.top(), expected);
+    ASSERT_EQ(ternary.top(), expected);
+    ASSERT_EQ(octary.top(), expected);
+    binary.pop();
+    ternary.pop();
+    octary.pop();
+  }
+}
+
+TEST(PriorityQueue, MatchesStdUnderMixedPushPop) {
+  MySTL::PriorityQueue<int> queue;
+  std::priority_queue<int> reference;
+
+  for (int i{}; i < 5000; ++i) {
+    int value = (i * 104729) % 997;
+    queue.push(value);
+    reference.push(value);
+
+    if (i % 3 == 0) {
+      ASSERT_EQ(queue.top(), reference.top());
+      queue.pop();
+      reference.pop();
+    }
+  }
+
+  while (!reference.empty()) {
+    ASSERT_EQ(queue.top(), reference.top());
+    queue.pop();
+    reference.pop();
+  }
+}
+
+TEST(PriorityQueue, PushRangeHeapifiesLargeAndSmallBatches) {
+  MySTL::PriorityQueue<int> queue;
+
+  queue.push_range(shuffled(1000));
+  EXPECT_EQ(queue.top(), 999);
+
+  MySTL::Vector<int> small{5000, -1, 3};
+  queue.push_range(small);
+  EXPECT_EQ(queue.size(), 1003);
+  EXPECT_EQ(queue.top(), 5000);
+
+  queue.pop();
+  int previous = queue.top();
+  while (!queue.empty()) {
+    ASSERT_LE(queue.top(), previous);
+    previous = queue.top();
+    queue.pop();
+  }
+  EXPECT_EQ(previous, -1);
+}
+
+TEST(PriorityQueue, HoldsMoveOnlyElements) {
+  struct ByValue {
+    bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+      return *a < *b;
+    }
+  };
+  MySTL::PriorityQueue<std::unique_ptr<int>, ByValue> queue;
+
+  queue.push(std::make_unique<int>(2));
+  queue.emplace(new int(7));
+  queue.push(std::make_unique<int>(4));
+
+  EXPECT_EQ(*queue.top(), 7);
+  queue.pop();
+  EXPECT_EQ(*queue.top(), 4);
+}
+
+TEST(IndexedPriorityQueue, DecreaseKeyMovesElementToTop) {
+  MySTL::IndexedPriorityQueue<int, std::greater<int>> queue;
+  MySTL::Vector<MySTL::SlotHandle> handles;
+
+  for (int value : shuffled(100)) {
+    handles.push_back(queue.push(value + 10));
+  }
+
+  EXPECT_EQ(queue.top(), 10);
+  EXPECT_TRUE(queue.decrease_key(handles[42], 1));
+  EXPECT_EQ(queue.top(), 1);
+  EXPECT_EQ(queue.top_handle(), handles[42]);
+  EXPECT_EQ(queue[handles[42]], 1);
+}
+
+TEST(IndexedPriorityQueue, UpdateAndEraseKeepHeapOrder) {
+  MySTL::IndexedPriorityQueue<int> queue;
+  MySTL::Vector<MySTL::SlotHandle> handles;
+  MySTL::Vector<int> values = shuffled(300);
+
+  for (int value : values) {
+    handles.push_back(queue.push(value));
+  }
+
+  // Move some elements down, some up and erase others
+  for (size_t i{}; i < handles.size(); i += 3) {
+    values[i] = -values[i];
+    EXPECT_TRUE(queue.update(handles[i], values[i]));
+  }
+  for (size_t i{1}; i < handles.size(); i += 5) {
+    values[i] += 1000;
+    EXPECT_TRUE(queue.update(handles[i], values[i]));
+  }
+  for (size_t i{2}; i < handles.size(); i += 7) {
+    EXPECT_TRUE(queue.erase(handles[i]));
+    EXPECT_FALSE(queue.contains(handles[i]));
+    values[i] = INT32_MIN;
+  }
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  for (int expected : values) {
+    if (expected == INT32_MIN) {
+      break;
+    }
+    ASSERT_EQ(queue.top(), expected);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(IndexedPriorityQueue, StaleHandlesAreRejected) {
+  MySTL::IndexedPriorityQueue<int> queue;
+
+  MySTL::SlotHandle first = queue.push(1);
+  queue.pop();
+  MySTL::SlotHandle second = queue.push(2);
+
+  EXPECT_EQ(first.index, second.index);
+  EXPECT_FALSE(queue.contains(first));
+  EXPECT_FALSE(queue.erase(first));
+  EXPECT_FALSE(queue.decrease_key(first, 5));
+  EXPECT_FALSE(queue.update(first, 5));
+  EXPECT_THROW((void)queue.at(first), std::runtime_error);
+  EXPECT_EQ(queue.at(second), 2);
+}
+
+TEST(IndexedPriorityQueue, RunsDijkstra) {
+  // Small weighted graph as an adjacency list of (target, weight)
+  using Edges = MySTL::Vector<std::pair<size_t, int>>;
+  MySTL::Vector<Edges> graph(5, Edges());
+  graph[0] = {{1, 4}, {2, 1}};
+  graph[2] = {{1, 2}, {3, 5}};
+  graph[1] = {{3, 1}};
+  graph[3] = {{4, 3}};
+
+  using Entry = std::pair<int, size_t>;
+  MySTL::IndexedPriorityQueue<Entry, std::greater<Entry>> queue;
+  MySTL::Vector<int> distance(5, INT32_MAX);
+  MySTL::Vector<MySTL::SlotHandle> handles(5, MySTL::SlotHandle{});
+
+  distance[0] = 0;
+  handles[0] = queue.push({0, 0});
+  while (!queue.empty()) {
+    auto [dist, node] = queue.top();
+    queue.pop();
+
+    for (auto [target, weight] : graph[node]) {
+      if (dist + weight < distance[target]) {
+        distance[target] = dist + weight;
+        if (!queue.decrease_key(handles[target], {distance[target], target})) {
+          handles[target] = queue.push({distance[target], target});
+        }
+      }
+    }
+  }
+
+  EXPECT_TRUE(std::ranges::equal(distance, std::initializer_list<int>{0, 3, 1, 4, 7}));
+}
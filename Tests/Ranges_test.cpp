@@ -0,0 +1,201 @@
+#include "Source/Ranges.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+
+#include "Source/TrackingAllocator.hpp"
+#include "Source/Vector.hpp"
+
+using TVector = MySTL::Vector<int>;
+namespace Views = MySTL::Views;
+
+template <typename R, typename T>
+static bool equals(const R& range, std::initializer_list<T> expected) {
+  return std::ranges::equal(range, expected);
+}
+
+static TVector iota(int count) {
+  TVector items;
+  for (int i{}; i < count; ++i) {
+    items.push_back(i);
+  }
+  return items;
+}
+
+TEST(Ranges, VectorIteratorsModelContiguousIterator) {
+  static_assert(std::contiguous_iterator<TVector::Iterator>);
+  static_assert(std::contiguous_iterator<TVector::ConstIterator>);
+  static_assert(std::ranges::contiguous_range<TVector>);
+  static_assert(std::ranges::sized_range<const TVector>);
+  static_assert(std::sized_sentinel_for<TVector::ConstIterator, TVector::ConstIterator>);
+
+  TVector items = iota(10);
+  const TVector& constItems = items;
+
+  EXPECT_EQ(constItems.end() - constItems.begin(), 10);
+  EXPECT_EQ((2 + items.begin())[3], 5);
+
+  TVector::ConstIterator it = items.begin();
+  EXPECT_EQ(it, constItems.begin());
+  EXPECT_TRUE(std::ranges::is_sorted(constItems));
+  EXPECT_EQ(*std::ranges::lower_bound(constItems, 7), 7);
+}
+
+TEST(Ranges, ViewIteratorsModelForwardIterator) {
+  TVector items = iota(10);
+
+  auto evens = items | Views::filter([](int x) { return x % 2 == 0; });
+  auto squares = items | Views::transform([](int x) { return x * x; });
+
+  static_assert(std::forward_iterator<decltype(evens.begin())>);
+  static_assert(std::forward_iterator<decltype(squares.begin())>);
+  static_assert(std::sentinel_for<std::default_sentinel_t, decltype(evens.begin())>);
+
+  EXPECT_EQ(std::ranges::distance(evens.begin(), evens.end()), 5);
+  EXPECT_EQ(*std::ranges::find(squares.begin(), squares.end(), 49), 49);
+}
+
+TEST(Ranges, FilterTransformTakeFuseIntoOnePass) {
+  TVector items = iota(100);
+  int predicateCalls{};
+
+  auto pipeline = items | Views::filter([&](int x) {
+                    ++predicateCalls;
+                    return x % 3 == 0;
+                  }) |
+                  Views::transform([](int x) { return x * 10; }) | Views::take(4);
+
+  EXPECT_EQ(predicateCalls, 0);
+
+  TVector result = pipeline | MySTL::to<MySTL::Vector>();
+  EXPECT_TRUE(equals(result, {0, 30, 60, 90}));
+  // 0..9 only: take does not advance the filter past its last element
+  EXPECT_EQ(predicateCalls, 10);
+}
+
+TEST(Ranges, ViewsSeeChangesOfReferencedVector) {
+  TVector items = iota(4);
+  auto doubled = items | Views::transform([](int x) { return x * 2; });
+
+  items[0] = 50;
+  EXPECT_EQ(*doubled.begin(), 100);
+
+  for (int& item : items | Views::filter([](int x) { return x > 1; })) {
+    item = -1;
+  }
+  EXPECT_TRUE(equals(items, {-1, 1, -1, -1}));
+}
+
+TEST(Ranges, ViewsOwnTemporaryVectors) {
+  auto pipeline = iota(6) | Views::transform([](int x) { return x + 1; });
+
+  int sum{};
+  for (int item : pipeline) {
+    sum += item;
+  }
+
+  EXPECT_EQ(sum, 21);
+  EXPECT_EQ(pipeline.size(), 6);
+}
+
+TEST(Ranges, TakeStopsAtShorterOfCountAndRange) {
+  TVector items = iota(3);
+
+  EXPECT_EQ((items | Views::take(2)).size(), 2);
+  EXPECT_EQ((items | Views::take(10)).size(), 3);
+  EXPECT_TRUE(equals(items | Views::take(10) | MySTL::to<MySTL::Vector>(), {0, 1, 2}));
+  EXPECT_TRUE((items | Views::take(0) | MySTL::to<MySTL::Vector>()).empty());
+}
+
+TEST(Ranges, ChunkSplitsWithRemainder) {
+  TVector items = iota(7);
+  auto chunks = items | Views::chunk(3);
+
+  EXPECT_EQ(chunks.size(), 3);
+
+  MySTL::Vector<int> sums;
+  MySTL::Vector<size_t> sizes;
+  for (auto chunk : chunks) {
+    int sum{};
+    for (int item : chunk) {
+      sum += item;
+    }
+    sums.push_back(sum);
+    sizes.push_back(chunk.size());
+  }
+
+  EXPECT_TRUE(equals(sums, {3, 12, 6}));
+  EXPECT_TRUE(equals(sizes, {size_t{3}, size_t{3}, size_t{1}}));
+  EXPECT_THROW((void)(items | Views::chunk(0)), std::runtime_error);
+}
+
+TEST(Ranges, ChunkOverUnsizedView) {
+  TVector items = iota(10);
+  auto chunks = items | Views::filter([](int x) { return x % 2 == 1; }) | Views::chunk(2);
+
+  MySTL::Vector<int> firsts;
+  for (auto chunk : chunks) {
+    firsts.push_back(*chunk.begin());
+  }
+
+  EXPECT_TRUE(equals(firsts, {1, 5, 9}));
+}
+
+TEST(Ranges, ZipStopsAtShortestRange) {
+  TVector numbers = iota(5);
+  MySTL::Vector<char> letters{'a', 'b', 'c'};
+
+  auto zipped = Views::zip(numbers, letters);
+  EXPECT_EQ(zipped.size(), 3);
+
+  MySTL::Vector<std::tuple<int, char>> pairs = zipped | MySTL::to<MySTL::Vector>();
+  EXPECT_EQ(pairs.size(), 3);
+  EXPECT_EQ(pairs[2], std::make_tuple(2, 'c'));
+
+  for (auto [number, letter] : Views::zip(numbers, letters)) {
+    number += letter;
+  }
+  EXPECT_EQ(numbers[1], 1 + 'b');
+  EXPECT_EQ(numbers[4], 4);
+}
+
+TEST(Ranges, EnumerateYieldsIndexAndReference) {
+  MySTL::Vector<char> letters{'x', 'y', 'z'};
+
+  size_t expected{};
+  for (auto [index, letter] : letters | Views::enumerate) {
+    EXPECT_EQ(index, expected++);
+    letter = static_cast<char>('a' + index);
+  }
+
+  EXPECT_TRUE(equals(letters, {'a', 'b', 'c'}));
+
+  auto indexed = letters | Views::enumerate | MySTL::to<MySTL::Vector>();
+  EXPECT_EQ(indexed[1], (std::pair<size_t, char>{1, 'b'}));
+}
+
+TEST(Ranges, ToReservesOnceWhenLengthIsKnown) {
+  using TrackedVector = MySTL::Vector<long, MySTL::TrackingAllocator<long>>;
+  MySTL::AllocationStats& stats = MySTL::defaultAllocationStats();
+  TVector items = iota(1000);
+
+  stats.reset();
+  TrackedVector sized =
+      items | Views::transform([](int x) { return x * 2L; }) | MySTL::to<TrackedVector>();
+
+  EXPECT_EQ(stats.allocations, 1);
+  EXPECT_EQ(sized.capacity(), 1000);
+  EXPECT_EQ(sized[999], 1998);
+
+  stats.reset();
+  TrackedVector filtered = items | Views::filter([](int x) { return x < 100; }) |
+                           Views::transform([](int x) { return x * 2L; }) |
+                           MySTL::to<TrackedVector>();
+
+  EXPECT_EQ(filtered.size(), 100);
+  EXPECT_GT(stats.allocations, 1);
+}
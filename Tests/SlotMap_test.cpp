@@ -0,0 +1,115 @@
+#include "Source/SlotMap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using TSlotMap = MySTL::SlotMap<int>;
+
+TEST(SlotMap, AppliesRuleOfFive) {
+  EXPECT_TRUE(std::is_constructible_v<TSlotMap>);
+  EXPECT_TRUE(std::is_destructible_v<TSlotMap>);
+  EXPECT_TRUE(std::is_copy_assignable_v<TSlotMap>);
+  EXPECT_TRUE(std::is_copy_constructible_v<TSlotMap>);
+  EXPECT_TRUE(std::is_move_assignable_v<TSlotMap>);
+  EXPECT_TRUE(std::is_move_constructible_v<TSlotMap>);
+}
+
+TEST(SlotMap, InsertReturnsHandleToElement) {
+  TSlotMap map;
+
+  auto a = map.insert(1);
+  auto b = map.emplace(2);
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map[a], 1);
+  EXPECT_EQ(map[b], 2);
+  EXPECT_NE(a, b);
+}
+
+TEST(SlotMap, HandlesStayValidAfterOtherErases) {
+  TSlotMap map;
+
+  auto a = map.insert(1);
+  auto b = map.insert(2);
+  auto c = map.insert(3);
+
+  EXPECT_TRUE(map.erase(a));
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map[b], 2);
+  EXPECT_EQ(map[c], 3);
+}
+
+TEST(SlotMap, ErasedHandleIsStale) {
+  TSlotMap map;
+
+  auto a = map.insert(1);
+  map.erase(a);
+
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_EQ(map.get(a), nullptr);
+  EXPECT_FALSE(map.erase(a));
+  EXPECT_THROW((void)map.at(a), std::runtime_error);
+}
+
+TEST(SlotMap, ReusedSlotDoesNotMatchOldHandle) {
+  TSlotMap map;
+
+  auto a = map.insert(1);
+  map.erase(a);
+  auto b = map.insert(2);
+
+  EXPECT_EQ(a.index, b.index);
+  EXPECT_NE(a.generation, b.generation);
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_EQ(map[b], 2);
+}
+
+TEST(SlotMap, DefaultHandleIsInvalid) {
+  TSlotMap map;
+  map.insert(1);
+
+  EXPECT_FALSE(map.contains(MySTL::SlotHandle{}));
+}
+
+TEST(SlotMap, IterationIsDense) {
+  TSlotMap map;
+
+  MySTL::SlotHandle handles[5];
+  for (int i{}; i < 5; ++i) {
+    handles[i] = map.insert(i);
+  }
+
+  map.erase(handles[1]);
+  map.erase(handles[3]);
+
+  int sum{};
+  size_t visited{};
+  for (int item : map) {
+    sum += item;
+    ++visited;
+  }
+
+  EXPECT_EQ(visited, 3);
+  EXPECT_EQ(sum, 0 + 2 + 4);
+
+  for (size_t i{}; i < map.size(); ++i) {
+    EXPECT_EQ(map[map.handleAt(i)], *(map.begin() + i));
+  }
+}
+
+TEST(SlotMap, ClearInvalidatesAllHandles) {
+  MySTL::SlotMap<std::string> map;
+
+  auto a = map.insert("a");
+  auto b = map.insert("b");
+  map.clear();
+
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_FALSE(map.contains(b));
+
+  auto c = map.insert("c");
+  EXPECT_EQ(map[c], "c");
+}
@@ -0,0 +1,202 @@
+#include "Source/String.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Source/TrackingAllocator.hpp"
+#include "Source/Vector.hpp"
+
+using TString = MySTL::String;
+
+TEST(String, AppliesRuleOfFive) {
+  EXPECT_TRUE(std::is_constructible_v<TString>);
+  EXPECT_TRUE(std::is_destructible_v<TString>);
+  EXPECT_TRUE(std::is_copy_assignable_v<TString>);
+  EXPECT_TRUE(std::is_copy_constructible_v<TString>);
+  EXPECT_TRUE(std::is_move_assignable_v<TString>);
+  EXPECT_TRUE(std::is_move_constructible_v<TString>);
+}
+
+TEST(String, FitsTwentyThreeCharactersInTwentyFourBytes) {
+  EXPECT_EQ(sizeof(TString), 24);
+  EXPECT_TRUE(MySTL::is_trivially_relocatable_v<TString>);
+
+  TString full("12345678901234567890123");
+  EXPECT_TRUE(full.isSmall());
+  EXPECT_EQ(full.size(), 23);
+  EXPECT_EQ(full.c_str()[23], '\0');
+
+  TString longer("123456789012345678901234");
+  EXPECT_FALSE(longer.isSmall());
+  EXPECT_EQ(longer.size(), 24);
+  EXPECT_EQ(longer, "123456789012345678901234");
+}
+
+TEST(String, DefaultIsEmptyAndNullTerminated) {
+  TString str;
+
+  EXPECT_TRUE(str.empty());
+  EXPECT_EQ(str.capacity(), TString::SmallCapacity);
+  EXPECT_STREQ(str.c_str(), "");
+}
+
+TEST(String, PushBackGrowsFromInlineToHeap) {
+  TString str;
+
+  for (int i{}; i < 100; ++i) {
+    str.push_back(static_cast<char>('a' + i % 26));
+  }
+
+  EXPECT_EQ(str.size(), 100);
+  EXPECT_FALSE(str.isSmall());
+  EXPECT_EQ(str[26], 'a');
+  EXPECT_EQ(str.back(), 'v');
+  EXPECT_EQ(str.c_str()[100], '\0');
+
+  str.pop_back();
+  EXPECT_EQ(str.back(), 'u');
+}
+
+TEST(String, CopyAndMoveKeepContent) {
+  TString small("small");
+  TString large(40, 'x');
+
+  TString smallCopy(small);
+  TString largeCopy(large);
+  EXPECT_EQ(smallCopy, small);
+  EXPECT_EQ(largeCopy, large);
+  EXPECT_NE(largeCopy.data(), large.data());
+
+  const char* largeData = large.data();
+  TString moved(std::move(large));
+  EXPECT_EQ(moved.data(), largeData);
+  EXPECT_TRUE(large.empty());
+
+  smallCopy = moved;
+  EXPECT_EQ(smallCopy, moved);
+  moved = std::move(small);
+  EXPECT_EQ(moved, "small");
+}
+
+TEST(String, AppendIncludingItself) {
+  TString str("abc");
+
+  str += "def";
+  str += 'g';
+  EXPECT_EQ(str, "abcdefg");
+
+  str.append(str);
+  str.append(str);
+  EXPECT_EQ(str.size(), 28);
+  EXPECT_EQ(str.view().substr(21), "abcdefg");
+
+  str.append(3, '!');
+  EXPECT_TRUE(str.ends_with("g!!!"));
+}
+
+TEST(String, ResizeAndClear) {
+  TString str("abc");
+
+  str.resize(30, 'z');
+  EXPECT_EQ(str.size(), 30);
+  EXPECT_EQ(str[29], 'z');
+
+  str.resize(2);
+  EXPECT_EQ(str, "ab");
+
+  str.clear();
+  EXPECT_TRUE(str.empty());
+}
+
+TEST(String, FindSubstringAndCharacter) {
+  TString str("the quick brown fox jumps over the lazy dog, the end");
+
+  EXPECT_EQ(str.find("the"), 0);
+  EXPECT_EQ(str.find("the", 1), 31);
+  EXPECT_EQ(str.find("the end"), 45);
+  EXPECT_EQ(str.find("lazy dog"), 35);
+  EXPECT_EQ(str.find("cat"), TString::npos);
+  EXPECT_EQ(str.find(""), 0);
+  EXPECT_EQ(str.find('q'), 4);
+  EXPECT_EQ(str.find('!'), TString::npos);
+  EXPECT_TRUE(str.contains("brown"));
+}
+
+TEST(String, FindMatchesStdAcrossBlockBoundaries) {
+  std::string reference;
+  for (int i{}; i < 200; ++i) {
+    reference.push_back(static_cast<char>('a' + (i * 7) % 5));
+  }
+
+  TString str(reference);
+  for (size_t start{}; start < 180; start += 13) {
+    for (size_t length{1}; length < 20; length += 3) {
+      std::string needle = reference.substr(start, length);
+      EXPECT_EQ(str.find(needle), reference.find(needle));
+    }
+  }
+}
+
+TEST(String, CompareOrdersLexicographically) {
+  TString a("apple");
+  TString b("apples");
+  TString c("banana");
+
+  EXPECT_LT(a, b);
+  EXPECT_LT(b, c);
+  EXPECT_EQ(a.compare("apple"), 0);
+  EXPECT_GT(c.compare("apple"), 0);
+}
+
+TEST(String, ComparesAndAppendsEmptyViewsWithNullData) {
+  TString empty;
+  TString text("text");
+
+  EXPECT_TRUE(TString{} == MySTL::StringView{});
+  EXPECT_EQ(empty.compare(MySTL::StringView{}), 0);
+  EXPECT_GT(text.compare(MySTL::StringView{}), 0);
+  EXPECT_FALSE(text == MySTL::StringView{});
+
+  text.append(MySTL::StringView{});
+  EXPECT_EQ(text, "text");
+  text = MySTL::StringView{};
+  EXPECT_TRUE(text.empty());
+}
+
+TEST(String, SubstrAndAtChecksBounds) {
+  TString str("hello world");
+
+  EXPECT_EQ(str.substr(6), "world");
+  EXPECT_EQ(str.substr(0, 5), "hello");
+  EXPECT_THROW((void)str.substr(12), std::runtime_error);
+  EXPECT_THROW((void)str.at(11), std::runtime_error);
+}
+
+TEST(String, UsesAllocatorForHeapStorageOnly) {
+  MySTL::AllocationStats stats;
+  using TrackedString = MySTL::BasicString<MySTL::TrackingAllocator<char>>;
+
+  {
+    TrackedString small("short", MySTL::TrackingAllocator<char>(stats));
+    EXPECT_EQ(stats.allocations, 0);
+
+    TrackedString large("definitely longer than twenty three", MySTL::TrackingAllocator<char>(stats));
+    EXPECT_EQ(stats.allocations, 1);
+  }
+
+  EXPECT_EQ(stats.liveBytes, 0);
+}
+
+TEST(String, VectorOfStringsSurvivesRelocation) {
+  MySTL::Vector<TString> strings;
+
+  for (int i{}; i < 100; ++i) {
+    strings.push_back(TString(static_cast<size_t>(i), static_cast<char>('a' + i % 26)));
+  }
+
+  for (int i{}; i < 100; ++i) {
+    ASSERT_EQ(strings[i].size(), static_cast<size_t>(i));
+    ASSERT_EQ(strings[i].data()[strings[i].size()], '\0');
+  }
+
+  EXPECT_EQ(strings[50][0], 'y');
+}
@@ -0,0 +1,259 @@
+#include "Source/ThreadCachingAllocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "Source/UniquePointer.hpp"
+#include "Source/Vector.hpp"
+
+template <typename T>
+using TVector = MySTL::Vector<T, MySTL::ThreadCachingAllocator<T>>;
+
+TEST(ThreadCachingAllocator, SizeClassesCoverEveryRequest) {
+  size_t previous = 0;
+
+  for (size_t bytes{1}; bytes <= MySTL::Detail::TcMaxSmallSize; ++bytes) {
+    size_t sizeClass = MySTL::Detail::tcSizeClass(bytes);
+    size_t classSize = MySTL::Detail::tcClassSize(sizeClass);
+
+    ASSERT_LT(sizeClass, MySTL::Detail::TcSizeClassCount);
+    ASSERT_GE(classSize, bytes);
+    ASSERT_LE(classSize - bytes, std::max<size_t>(classSize / 4, 15)) << "bytes " << bytes;
+    ASSERT_EQ(classSize % MySTL::Detail::TcMinAlignment, 0);
+    ASSERT_GE(sizeClass, previous);
+    previous = sizeClass;
+  }
+}
+
+TEST(ThreadCachingAllocator, PlugsIntoVector) {
+  TVector<int> numbers;
+  TVector<TVector<int>> nested;
+
+  for (int i{}; i < 10000; ++i) {
+    numbers.push_back(i);
+  }
+  for (int i{}; i < 100; ++i) {
+    nested.push_back(TVector<int>(static_cast<size_t>(i), i));
+  }
+
+  for (int i{}; i < 10000; ++i) {
+    ASSERT_EQ(numbers[i], i);
+  }
+  EXPECT_EQ(nested[42].size(), 42);
+  EXPECT_EQ(nested[42][41], 42);
+}
+
+TEST(ThreadCachingAllocator, ReusesFreedBlocks) {
+  MySTL::ThreadCachingAllocator<char> alloc;
+
+  char* first = alloc.allocate(100);
+  alloc.deallocate(first, 100);
+  char* second = alloc.allocate(100);
+
+  EXPECT_EQ(first, second);
+  alloc.deallocate(second, 100);
+}
+
+TEST(ThreadCachingAllocator, LargeAndOverAlignedRequestsBypassCache) {
+  struct alignas(64) Line {
+    char bytes[64];
+  };
+  MySTL::ThreadCachingAllocator<Line> lines;
+  MySTL::ThreadCachingAllocator<char> chars;
+
+  Line* line = lines.allocate(3);
+  char* large = chars.allocate(1 << 20);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(line) % 64, 0);
+
+  large[(1 << 20) - 1] = 'x';
+  chars.deallocate(large, 1 << 20);
+  lines.deallocate(line, 3);
+}
+
+TEST(ThreadCachingAllocator, AllocateUniqueDestroysThroughAllocator) {
+  struct Counted {
+    explicit Counted(int& destroyed) : destroyed(destroyed) {}
+    ~Counted() { ++destroyed; }
+    int& destroyed;
+  };
+  int destroyed = 0;
+
+  {
+    auto p = MySTL::allocate_unique<Counted>(MySTL::ThreadCachingAllocator<char>(), destroyed);
+    auto q = std::move(p);
+    EXPECT_TRUE(p == nullptr);
+    EXPECT_EQ(&q->destroyed, &destroyed);
+  }
+
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(ThreadCachingAllocator, CrossThreadFreesReturnToOwner) {
+  constexpr size_t BlockCount = 500;
+  MySTL::ThreadCachingAllocator<char> alloc;
+  std::set<char*> original;
+
+  for (size_t i{}; i < BlockCount; ++i) {
+    original.insert(alloc.allocate(200));
+  }
+  size_t remoteBefore = MySTL::threadCachingStats().remoteFrees;
+
+  std::thread([&] {
+    for (char* ptr : original) {
+      alloc.deallocate(ptr, 200);
+    }
+  }).join();
+
+  // Once its cache runs dry the owner collects the remote frees and hands the same blocks out again
+  std::vector<char*> again;
+  size_t reused = 0;
+  for (size_t i{}; i < 2 * BlockCount; ++i) {
+    again.push_back(alloc.allocate(200));
+    reused += original.count(again.back());
+  }
+
+  EXPECT_EQ(reused, BlockCount);
+  EXPECT_GE(MySTL::threadCachingStats().remoteFrees - remoteBefore, BlockCount);
+  for (char* ptr : again) {
+    alloc.deallocate(ptr, 200);
+  }
+}
+
+TEST(ThreadCachingAllocator, ChunksTakenFromCentralPoolAreCachedByNewOwner) {
+  constexpr size_t BlockCount = 2000;
+  constexpr size_t BlockSize = 3000;
+  MySTL::ThreadCachingAllocator<char> alloc;
+  std::set<char*> freedByFirst;
+  std::vector<char*> keptByFirst;
+  std::promise<void> firstExited;
+  std::promise<void> secondAttached;
+
+  // The second thread has its own heap before the first exits, so it cannot adopt the first's
+  std::thread second([&, firstExitedFuture = firstExited.get_future()] {
+    alloc.deallocate(alloc.allocate(16), 16);
+    secondAttached.set_value();
+    firstExitedFuture.wait();
+
+    std::vector<char*> blocks;
+    size_t reused = 0;
+    size_t remoteBefore = MySTL::threadCachingStats().remoteFrees;
+    for (int round{}; round < 2; ++round) {
+      for (size_t i{}; i < BlockCount; ++i) {
+        blocks.push_back(alloc.allocate(BlockSize));
+        reused += freedByFirst.count(blocks.back());
+      }
+      for (char* ptr : blocks) {
+        alloc.deallocate(ptr, BlockSize);
+      }
+      blocks.clear();
+    }
+
+    EXPECT_GE(reused, BlockCount / 2);
+    EXPECT_EQ(MySTL::threadCachingStats().remoteFrees - remoteBefore, 0);
+  });
+  secondAttached.get_future().wait();
+
+  // The first thread frees every other block and exits, which hands its chunks to the central pool
+  std::thread([&] {
+    for (size_t i{}; i < BlockCount; ++i) {
+      char* ptr = alloc.allocate(BlockSize);
+      if (i % 2 == 0) {
+        keptByFirst.push_back(ptr);
+      } else {
+        freedByFirst.insert(ptr);
+      }
+    }
+    for (char* ptr : freedByFirst) {
+      alloc.deallocate(ptr, BlockSize);
+    }
+  }).join();
+
+  size_t transfers = MySTL::threadCachingStats().centralTransfers;
+  firstExited.set_value();
+  second.join();
+
+  EXPECT_GT(MySTL::threadCachingStats().centralTransfers, transfers);
+  for (char* ptr : keptByFirst) {
+    alloc.deallocate(ptr, BlockSize);
+  }
+}
+
+TEST(ThreadCachingAllocator, ExitedThreadHeapsAreReused) {
+  auto churn = [] {
+    TVector<int> numbers;
+    for (int i{}; i < 1000; ++i) {
+      numbers.push_back(i);
+    }
+  };
+
+  std::thread(churn).join();
+  size_t heaps = MySTL::threadCachingStats().heaps;
+
+  for (int i{}; i < 8; ++i) {
+    std::thread(churn).join();
+  }
+
+  EXPECT_EQ(MySTL::threadCachingStats().heaps, heaps);
+  EXPECT_GE(MySTL::threadCachingStats().numaNodes, 1);
+}
+
+// Each thread builds vectors and hands them to the next thread, which checks and frees them, so
+// every block is freed by a thread other than the one that allocated it
+TEST(ThreadCachingAllocator, PipelinedChurnAcrossThreads) {
+  constexpr int ThreadCount = 4;
+  constexpr int ItemsPerThread = 2000;
+
+  struct Mailbox {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<MySTL::UniquePointer<TVector<int>,
+                                    MySTL::AllocatorDeleter<TVector<int>,
+                                                            MySTL::ThreadCachingAllocator<char>>>>
+        items;
+  };
+  Mailbox mailboxes[ThreadCount];
+
+  std::vector<std::thread> threads;
+  for (int t{}; t < ThreadCount; ++t) {
+    threads.emplace_back([&, t] {
+      Mailbox& outbox = mailboxes[(t + 1) % ThreadCount];
+      Mailbox& inbox = mailboxes[t];
+
+      for (int i{}; i < ItemsPerThread; ++i) {
+        auto item = MySTL::allocate_unique<TVector<int>>(MySTL::ThreadCachingAllocator<char>());
+        for (int j{}; j < i % 64; ++j) {
+          item->push_back(t * ItemsPerThread + i);
+        }
+        {
+          std::lock_guard lock(outbox.mutex);
+          outbox.items.push_back(std::move(item));
+        }
+        outbox.ready.notify_one();
+      }
+
+      for (int received{}; received < ItemsPerThread; ++received) {
+        std::unique_lock lock(inbox.mutex);
+        inbox.ready.wait(lock, [&] { return !inbox.items.empty(); });
+        auto item = std::move(inbox.items.front());
+        inbox.items.pop_front();
+        lock.unlock();
+
+        ASSERT_EQ(item->size(), static_cast<size_t>(received % 64));
+        for (int value : *item) {
+          ASSERT_EQ(value, ((t + ThreadCount - 1) % ThreadCount) * ItemsPerThread + received);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
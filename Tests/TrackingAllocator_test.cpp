@@ -0,0 +1,66 @@
+#include "Source/TrackingAllocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "Source/Vector.hpp"
+
+using TAllocator = MySTL::TrackingAllocator<int>;
+
+TEST(TrackingAllocator, RecordsAllocationsAndBytes) {
+  MySTL::AllocationStats stats;
+  TAllocator alloc(stats);
+
+  int* p = alloc.allocate(4);
+  EXPECT_EQ(stats.allocations, 1);
+  EXPECT_EQ(stats.bytesAllocated, 4 * sizeof(int));
+  EXPECT_EQ(stats.liveBytes, 4 * sizeof(int));
+
+  alloc.deallocate(p, 4);
+  EXPECT_EQ(stats.deallocations, 1);
+  EXPECT_EQ(stats.liveBytes, 0);
+  EXPECT_EQ(stats.peakBytes, 4 * sizeof(int));
+}
+
+TEST(TrackingAllocator, ResetRestartsPeakFromLiveBytes) {
+  MySTL::AllocationStats stats;
+  TAllocator alloc(stats);
+
+  int* small = alloc.allocate(1);
+  int* big = alloc.allocate(8);
+  alloc.deallocate(big, 8);
+
+  stats.reset();
+  EXPECT_EQ(stats.allocations, 0);
+  EXPECT_EQ(stats.peakBytes, sizeof(int));
+
+  alloc.deallocate(small, 1);
+}
+
+TEST(TrackingAllocator, ReboundCopiesShareStats) {
+  MySTL::AllocationStats stats;
+  TAllocator alloc(stats);
+
+  std::allocator_traits<TAllocator>::rebind_alloc<double> rebound(alloc);
+  EXPECT_EQ(&rebound.stats(), &stats);
+
+  double* p = rebound.allocate(2);
+  EXPECT_EQ(stats.bytesAllocated, 2 * sizeof(double));
+  rebound.deallocate(p, 2);
+}
+
+TEST(TrackingAllocator, TracksVectorGrowth) {
+  MySTL::AllocationStats stats;
+  {
+    MySTL::Vector<int, TAllocator> v{TAllocator(stats)};
+
+    for (int i{}; i < 5; ++i) {
+      v.push_back(i);
+    }
+
+    // Capacity doubles 1 -> 2 -> 4 -> 8
+    EXPECT_EQ(stats.allocations, 4);
+    EXPECT_EQ(stats.liveBytes, 8 * sizeof(int));
+  }
+
+  EXPECT_EQ(stats.liveBytes, 0);
+}
@@ -146,3 +146,30 @@ TEST(Vector, AssignmentWithInitializerList) {
   EXPECT_EQ(v.front(), 1);
   EXPECT_EQ(v.back(), 4);
 }
+
+TEST(Vector, CopyAssignmentReplacesContent) {
+  TVector v{1, 2, 3};
+  TVector other{4, 5};
+
+  v = other;
+
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v.front(), 4);
+  EXPECT_EQ(v.back(), 5);
+}
+
+TEST(Vector, MoveTakesOwnershipOfStorage) {
+  TVector v{1, 2, 3};
+  const int* data = &v[0];
+
+  TVector moved(std::move(v));
+  EXPECT_EQ(&moved[0], data);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(v.empty());
+
+  TVector assigned{7};
+  assigned = std::move(moved);
+  EXPECT_EQ(&assigned[0], data);
+  EXPECT_EQ(assigned.size(), 3);
+  EXPECT_TRUE(moved.empty());
+}